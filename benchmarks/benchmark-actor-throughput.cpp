@@ -0,0 +1,62 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <string>
+#include <vector>
+
+#include <traeger/actor/Actor.hpp>
+
+#include "benchmark.hpp"
+
+namespace
+{
+    using namespace traeger;
+
+    class Inventory
+    {
+        Map items_;
+
+    public:
+        auto store(const String &key, const Map &item) -> Int
+        {
+            items_.set(key, item);
+            return static_cast<Int>(items_.size());
+        }
+
+        auto count() const noexcept -> Int
+        {
+            return static_cast<Int>(items_.size());
+        }
+    };
+}
+
+int main()
+{
+    using traeger::benchmark::measure;
+
+    constexpr int messages = 10000;
+    const auto scheduler = Scheduler{Threads{4}};
+    auto inventory_actor = make_actor<Inventory>();
+    inventory_actor.define("store", &Inventory::store);
+    inventory_actor.define("count", &Inventory::count);
+    const auto mailbox = inventory_actor.mailbox();
+
+    measure("send x10000", 10, [&scheduler, &mailbox]
+            {
+                auto promises = std::vector<Promise>{};
+                promises.reserve(messages);
+                for (int n = 0; n < messages; ++n)
+                {
+                    const auto item = make_map("id", n,
+                                               "price", n * 0.5,
+                                               "tags", make_list("a", "b", "c"));
+                    promises.push_back(mailbox.send(scheduler,
+                                                    "store",
+                                                    make_list("item-" + std::to_string(n % 100), item)));
+                }
+                for (const auto &promise : promises)
+                {
+                    promise.wait();
+                }
+            });
+    return 0;
+}
@@ -0,0 +1,51 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <string>
+
+#include <traeger/format/Format.hpp>
+#include <traeger/value/Value.hpp>
+
+#include "benchmark.hpp"
+
+namespace
+{
+    using namespace traeger;
+    using traeger::benchmark::measure;
+
+    auto make_message(const int width) -> Value
+    {
+        auto items = List{};
+        for (int n = 0; n < width; ++n)
+        {
+            items.append(make_map("id", n,
+                                  "name", "item-" + std::to_string(n),
+                                  "price", n * 0.5,
+                                  "tags", make_list("a", "b", "c")));
+        }
+        return make_map("count", width, "items", std::move(items));
+    }
+
+    auto run(const char *name,
+             const traeger_format_t *format,
+             const Value &message) -> void
+    {
+        if (format == nullptr)
+        {
+            return;
+        }
+        const auto encoded = format->encode(message).first.value();
+        measure((std::string{name} + " encode").c_str(), 200, [format, &message]
+                { format->encode(message); });
+        measure((std::string{name} + " decode").c_str(), 200, [format, &encoded]
+                { format->decode(encoded); });
+    }
+}
+
+int main()
+{
+    const auto message = make_message(1000);
+    run("json", Format::by_name("json"), message);
+    run("msgpack", Format::by_name("msgpack"), message);
+    run("yaml", Format::by_name("yaml"), message);
+    return 0;
+}
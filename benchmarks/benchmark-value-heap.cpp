@@ -0,0 +1,120 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <traeger/value/Memory_impl.hpp>
+
+#include "benchmark.hpp"
+
+namespace
+{
+    // The heap that immer uses for nodes of the given size.
+    template <std::size_t Size>
+    using heap = typename traeger::memory_policy::heap::template optimized<Size>::type;
+
+    constexpr std::size_t nodes_count = 1000;
+
+    template <std::size_t Size>
+    auto allocate_nodes() -> std::vector<void *>
+    {
+        auto nodes = std::vector<void *>(nodes_count);
+        for (auto &node : nodes)
+        {
+            node = heap<Size>::allocate(Size);
+        }
+        return nodes;
+    }
+
+    template <std::size_t Size>
+    auto deallocate_nodes(const std::vector<void *> &nodes) -> void
+    {
+        for (auto *node : nodes)
+        {
+            heap<Size>::deallocate(Size, node);
+        }
+    }
+
+    // The nodes made by one thread are released by another one, as the
+    // values sent in messages to actors.
+    template <std::size_t Size>
+    struct hand_over
+    {
+        hand_over()
+            : consumer_([this]
+                        { consume(); })
+        {
+        }
+
+        ~hand_over()
+        {
+            {
+                std::unique_lock lock{mutex_};
+                done_ = true;
+            }
+            condition_.notify_one();
+            consumer_.join();
+        }
+
+        auto produce() -> void
+        {
+            auto nodes = allocate_nodes<Size>();
+            {
+                std::unique_lock lock{mutex_};
+                batches_.push_back(std::move(nodes));
+            }
+            condition_.notify_one();
+        }
+
+    private:
+        auto consume() -> void
+        {
+            std::unique_lock lock{mutex_};
+            while (true)
+            {
+                condition_.wait(lock, [this]
+                                { return done_ || !batches_.empty(); });
+                auto batches = std::move(batches_);
+                batches_.clear();
+                lock.unlock();
+                for (const auto &nodes : batches)
+                {
+                    deallocate_nodes<Size>(nodes);
+                }
+                lock.lock();
+                if (done_ && batches_.empty())
+                {
+                    return;
+                }
+            }
+        }
+
+        std::mutex mutex_;
+        std::condition_variable condition_;
+        std::vector<std::vector<void *>> batches_;
+        bool done_ = false;
+        std::thread consumer_;
+    };
+}
+
+int main()
+{
+    using traeger::benchmark::measure;
+
+    measure("churn 1000 nodes x 64", 5000, []
+            { deallocate_nodes<64>(allocate_nodes<64>()); });
+
+    measure("churn 1000 nodes x 1024", 5000, []
+            { deallocate_nodes<1024>(allocate_nodes<1024>()); });
+
+    {
+        auto nodes = hand_over<256>{};
+        measure("hand over 1000 nodes x 256", 5000, [&nodes]
+                { nodes.produce(); });
+    }
+    return 0;
+}
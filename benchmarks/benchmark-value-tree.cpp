@@ -0,0 +1,50 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <string>
+
+#include <traeger/value/Value.hpp>
+
+#include "benchmark.hpp"
+
+namespace
+{
+    using namespace traeger;
+
+    auto make_tree(const int width) -> Value
+    {
+        auto items = List{};
+        for (int n = 0; n < width; ++n)
+        {
+            items.append(make_map("id", n,
+                                  "name", "item-" + std::to_string(n),
+                                  "price", n * 0.5,
+                                  "tags", make_list("a", "b", "c")));
+        }
+        return make_map("count", width, "items", std::move(items));
+    }
+}
+
+int main()
+{
+    using traeger::benchmark::measure;
+
+    measure("build and destroy tree x100", 2000, []
+            { make_tree(100); });
+
+    const auto tree = make_tree(1000);
+    measure("copy and modify tree x1000", 20000, [&tree]
+            {
+                auto map = tree.get_map().value();
+                map.set("count", 0);
+            });
+
+    measure("append list x10000", 200, []
+            {
+                auto list = List{};
+                for (int n = 0; n < 10000; ++n)
+                {
+                    list.append(n);
+                }
+            });
+    return 0;
+}
@@ -0,0 +1,38 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+
+#ifndef TRAEGER_BENCHMARK_MEMORY_POLICY
+#define TRAEGER_BENCHMARK_MEMORY_POLICY "default"
+#endif
+
+namespace traeger::benchmark
+{
+    // Runs the function the given number of times and prints the average
+    // time per iteration, tagged with the memory policy of the build so
+    // the outputs of two builds can be compared line by line.
+    template <typename Function>
+    auto measure(const char *name,
+                 const std::size_t iterations,
+                 Function &&function) -> double
+    {
+        using clock = std::chrono::steady_clock;
+        const auto start = clock::now();
+        for (std::size_t n = 0; n < iterations; ++n)
+        {
+            function();
+        }
+        const auto elapsed = std::chrono::duration<double, std::nano>(clock::now() - start);
+        const auto per_iteration = elapsed.count() / static_cast<double>(iterations);
+        std::cout << std::left << std::setw(12) << TRAEGER_BENCHMARK_MEMORY_POLICY
+                  << std::setw(32) << name
+                  << std::right << std::setw(14) << std::fixed << std::setprecision(1)
+                  << per_iteration << " ns/op" << std::endl;
+        return per_iteration;
+    }
+}
@@ -7,6 +7,7 @@ import (
 	"runtime"
 	"runtime/cgo"
 	"time"
+	"unsafe"
 )
 
 /*
@@ -124,6 +125,14 @@ func (result *Result) GetValueOrError() (*Value, error) {
 	return nil, nil
 }
 
+func (result *Result) IsTimeout() bool {
+	return bool(C.traeger_result_is_timeout(result.self))
+}
+
+func (result *Result) IsCancelled() bool {
+	return bool(C.traeger_result_is_cancelled(result.self))
+}
+
 func (result *Result) Set(variant any) bool {
 	switch variant := variant.(type) {
 	case bool:
@@ -320,6 +329,26 @@ func (promise *Promise) GetResult() *Result {
 	return wrap_c_result(result)
 }
 
+func (promise *Promise) Cancel() bool {
+	return bool(C.traeger_promise_cancel(promise.self))
+}
+
+func (promise *Promise) IsCancelled() bool {
+	return bool(C.traeger_promise_is_cancelled(promise.self))
+}
+
+func (promise *Promise) Wait() *Result {
+	var result *C.traeger_result_t
+	C.traeger_promise_wait(promise.self, &result)
+	return wrap_c_result(result)
+}
+
+func (promise *Promise) WaitFor(timeout time.Duration) (*Result, bool) {
+	var result *C.traeger_result_t
+	ready := C.traeger_promise_wait_for(promise.self, C.traeger_float_t(timeout.Seconds()), &result)
+	return wrap_c_result(result), bool(ready)
+}
+
 func (promise *Promise) SetPromise(other *Promise) {
 	C.traeger_promise_set_promise(promise.self, other.self)
 }
@@ -341,6 +370,43 @@ func (promise *Promise) Fail(errorFunc PromiseErrorFunc) {
 	C.traeger_go_promise_fail(promise.self, C.uintptr_t(handle))
 }
 
+func (promise *Promise) WithTimeout(timeout time.Duration) *Promise {
+	c_promise := C.traeger_promise_with_timeout(promise.self, C.traeger_float_t(timeout.Seconds()))
+	return wrap_c_promise(c_promise)
+}
+
+func c_promises(promises []*Promise) (**C.traeger_promise_t, C.size_t) {
+	if len(promises) == 0 {
+		return nil, 0
+	}
+	c_promises := make([]*C.traeger_promise_t, len(promises))
+	for i, promise := range promises {
+		c_promises[i] = promise.self
+	}
+	return (**C.traeger_promise_t)(unsafe.Pointer(&c_promises[0])), C.size_t(len(promises))
+}
+
+func WhenAll(scheduler *Scheduler, promises ...*Promise) *Promise {
+	c_array, c_size := c_promises(promises)
+	c_promise := C.traeger_promise_when_all(scheduler.self, c_array, c_size)
+	runtime.KeepAlive(promises)
+	return wrap_c_promise(c_promise)
+}
+
+func WhenAny(scheduler *Scheduler, promises ...*Promise) *Promise {
+	c_array, c_size := c_promises(promises)
+	c_promise := C.traeger_promise_when_any(scheduler.self, c_array, c_size)
+	runtime.KeepAlive(promises)
+	return wrap_c_promise(c_promise)
+}
+
+func Race(scheduler *Scheduler, promises ...*Promise) *Promise {
+	c_array, c_size := c_promises(promises)
+	c_promise := C.traeger_promise_race(scheduler.self, c_array, c_size)
+	runtime.KeepAlive(promises)
+	return wrap_c_promise(c_promise)
+}
+
 // Scheduler
 
 type WorkFunc func()
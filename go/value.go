@@ -150,6 +150,24 @@ func (list *List) Append(variant any) bool {
 	case *Map:
 		list.AppendMap(variant)
 		return true
+	case []byte:
+		list.AppendBlob(variant)
+		return true
+	case *Blob:
+		list.AppendValue(variant.value)
+		return true
+	case []float64:
+		list.AppendValue(FromFloatArray(variant).value)
+		return true
+	case *FloatArray:
+		list.AppendValue(variant.value)
+		return true
+	case []int64:
+		list.AppendValue(FromIntArray(variant).value)
+		return true
+	case *IntArray:
+		list.AppendValue(variant.value)
+		return true
 	case *Value:
 		list.AppendValue(variant)
 		return true
@@ -191,6 +209,10 @@ func (list *List) AppendMap(variant *Map) {
 	C.traeger_list_append_map(list.self, variant.self)
 }
 
+func (list *List) AppendBlob(variant []byte) {
+	C.traeger_list_append_blob(list.self, bytes_data(variant), C.size_t(len(variant)))
+}
+
 func (list *List) SetNull(index int, variant any) {
 	C.traeger_list_set_null(list.self, C.int(index))
 }
@@ -223,6 +245,10 @@ func (list *List) SetMap(index int, variant Map) {
 	C.traeger_list_set_map(list.self, C.int(index), variant.self)
 }
 
+func (list *List) SetBlob(index int, variant []byte) {
+	C.traeger_list_set_blob(list.self, C.int(index), bytes_data(variant), C.size_t(len(variant)))
+}
+
 func (list *List) AppendValue(variant *Value) {
 	C.traeger_list_append_value(list.self, variant.self)
 }
@@ -294,6 +320,18 @@ func (list *List) Unpack(variants ...any) (bool, error) {
 			if val, ok := value.GetMap(); ok {
 				*variant = val
 			}
+		case **Blob:
+			if val, ok := value.GetBlob(); ok {
+				*variant = val
+			}
+		case **FloatArray:
+			if val, ok := value.GetFloatArray(); ok {
+				*variant = val
+			}
+		case **IntArray:
+			if val, ok := value.GetIntArray(); ok {
+				*variant = val
+			}
 		case **Value:
 			*variant = value
 		default:
@@ -449,6 +487,24 @@ func (mapping *Map) Set(key string, variant any) bool {
 	case *Map:
 		mapping.SetMap(key, variant)
 		return true
+	case []byte:
+		mapping.SetBlob(key, variant)
+		return true
+	case *Blob:
+		mapping.SetValue(key, variant.value)
+		return true
+	case []float64:
+		mapping.SetValue(key, FromFloatArray(variant).value)
+		return true
+	case *FloatArray:
+		mapping.SetValue(key, variant.value)
+		return true
+	case []int64:
+		mapping.SetValue(key, FromIntArray(variant).value)
+		return true
+	case *IntArray:
+		mapping.SetValue(key, variant.value)
+		return true
 	case *Value:
 		mapping.SetValue(key, variant)
 		return true
@@ -490,6 +546,10 @@ func (mapping *Map) SetMap(key string, variant *Map) {
 	C.traeger_map_set_map(mapping.self, C._GoStringPtr(key), C._GoStringLen(key), variant.self)
 }
 
+func (mapping *Map) SetBlob(key string, variant []byte) {
+	C.traeger_map_set_blob(mapping.self, C._GoStringPtr(key), C._GoStringLen(key), bytes_data(variant), C.size_t(len(variant)))
+}
+
 func (mapping *Map) SetValue(key string, variant *Value) {
 	C.traeger_map_set_value(mapping.self, C._GoStringPtr(key), C._GoStringLen(key), variant.self)
 }
@@ -560,6 +620,18 @@ func (mapping *Map) Get(key string, variant any) (bool, error) {
 		if val, ok := value.GetMap(); ok {
 			*variant = val
 		}
+	case **Blob:
+		if val, ok := value.GetBlob(); ok {
+			*variant = val
+		}
+	case **FloatArray:
+		if val, ok := value.GetFloatArray(); ok {
+			*variant = val
+		}
+	case **IntArray:
+		if val, ok := value.GetIntArray(); ok {
+			*variant = val
+		}
 	case **Value:
 		*variant = value
 	default:
@@ -660,14 +732,17 @@ type ValueType struct {
 }
 
 const (
-	TypeNull   = C.TRAEGER_VALUE_TYPE_NULL
-	TypeBool   = C.TRAEGER_VALUE_TYPE_BOOL
-	TypeInt    = C.TRAEGER_VALUE_TYPE_INT
-	TypeUInt   = C.TRAEGER_VALUE_TYPE_UINT
-	TypeFloat  = C.TRAEGER_VALUE_TYPE_FLOAT
-	TypeString = C.TRAEGER_VALUE_TYPE_STRING
-	TypeList   = C.TRAEGER_VALUE_TYPE_LIST
-	TypeMap    = C.TRAEGER_VALUE_TYPE_MAP
+	TypeNull       = C.TRAEGER_VALUE_TYPE_NULL
+	TypeBool       = C.TRAEGER_VALUE_TYPE_BOOL
+	TypeInt        = C.TRAEGER_VALUE_TYPE_INT
+	TypeUInt       = C.TRAEGER_VALUE_TYPE_UINT
+	TypeFloat      = C.TRAEGER_VALUE_TYPE_FLOAT
+	TypeString     = C.TRAEGER_VALUE_TYPE_STRING
+	TypeList       = C.TRAEGER_VALUE_TYPE_LIST
+	TypeMap        = C.TRAEGER_VALUE_TYPE_MAP
+	TypeBlob       = C.TRAEGER_VALUE_TYPE_BLOB
+	TypeFloatArray = C.TRAEGER_VALUE_TYPE_FLOAT_ARRAY
+	TypeIntArray   = C.TRAEGER_VALUE_TYPE_INT_ARRAY
 )
 
 func FreeValue(value *Value) {
@@ -747,6 +822,24 @@ func (value *Value) Set(variant any) bool {
 	case *Map:
 		value.SetMap(variant)
 		return true
+	case []byte:
+		value.SetBlob(variant)
+		return true
+	case *Blob:
+		value.SetValue(variant.value)
+		return true
+	case []float64:
+		value.SetFloatArray(variant)
+		return true
+	case *FloatArray:
+		value.SetValue(variant.value)
+		return true
+	case []int64:
+		value.SetIntArray(variant)
+		return true
+	case *IntArray:
+		value.SetValue(variant.value)
+		return true
 	case *Value:
 		value.SetValue(variant)
 		return true
@@ -788,6 +881,26 @@ func (value *Value) SetMap(variant *Map) {
 	C.traeger_value_set_map(value.self, variant.self)
 }
 
+func (value *Value) SetBlob(variant []byte) {
+	C.traeger_value_set_blob(value.self, bytes_data(variant), C.size_t(len(variant)))
+}
+
+func (value *Value) SetFloatArray(variant []float64) {
+	var data *C.traeger_float_t
+	if len(variant) > 0 {
+		data = (*C.traeger_float_t)(unsafe.Pointer(&variant[0]))
+	}
+	C.traeger_value_set_float_array(value.self, data, C.size_t(len(variant)))
+}
+
+func (value *Value) SetIntArray(variant []int64) {
+	var data *C.traeger_int_t
+	if len(variant) > 0 {
+		data = (*C.traeger_int_t)(unsafe.Pointer(&variant[0]))
+	}
+	C.traeger_value_set_int_array(value.self, data, C.size_t(len(variant)))
+}
+
 func (value *Value) SetValue(variant *Value) {
 	C.traeger_value_set_value(value.self, variant.self)
 }
@@ -866,3 +979,143 @@ func (value *Value) GetMap() (*Map, bool) {
 	}
 	return nil, false
 }
+
+func (value *Value) GetBlob() (*Blob, bool) {
+	var data *C.char
+	var size C.size_t
+	if C.traeger_value_get_blob(value.self, &data, &size) {
+		return &Blob{value.Copy()}, true
+	}
+	return nil, false
+}
+
+func (value *Value) GetFloatArray() (*FloatArray, bool) {
+	var data *C.traeger_float_t
+	var size C.size_t
+	if C.traeger_value_get_float_array(value.self, &data, &size) {
+		return &FloatArray{value.Copy()}, true
+	}
+	return nil, false
+}
+
+func (value *Value) GetIntArray() (*IntArray, bool) {
+	var data *C.traeger_int_t
+	var size C.size_t
+	if C.traeger_value_get_int_array(value.self, &data, &size) {
+		return &IntArray{value.Copy()}, true
+	}
+	return nil, false
+}
+
+// Blob
+
+type Blob struct {
+	value *Value
+}
+
+func bytes_data(bytes []byte) *C.char {
+	if len(bytes) == 0 {
+		var empty byte
+		return (*C.char)(unsafe.Pointer(&empty))
+	}
+	return (*C.char)(unsafe.Pointer(&bytes[0]))
+}
+
+func FromBlob(bytes []byte) *Blob {
+	value := NewValue()
+	value.SetBlob(bytes)
+	return &Blob{value}
+}
+
+// Bytes returns the bytes of the blob without copying them, the slice is
+// only valid while the blob is reachable and must not be modified.
+func (blob *Blob) Bytes() []byte {
+	var data *C.char
+	var size C.size_t
+	C.traeger_value_get_blob(blob.value.self, &data, &size)
+	if size == 0 {
+		return []byte{}
+	}
+	return unsafe.Slice((*byte)(unsafe.Pointer(data)), int(size))
+}
+
+func (blob *Blob) Size() int {
+	var data *C.char
+	var size C.size_t
+	C.traeger_value_get_blob(blob.value.self, &data, &size)
+	return int(size)
+}
+
+func (blob *Blob) Equal(other *Blob) bool {
+	return blob.value.Equal(other.value)
+}
+
+// FloatArray
+
+type FloatArray struct {
+	value *Value
+}
+
+func FromFloatArray(elements []float64) *FloatArray {
+	value := NewValue()
+	value.SetFloatArray(elements)
+	return &FloatArray{value}
+}
+
+// Elements returns the elements of the array without copying them, the
+// slice is only valid while the array is reachable and must not be modified.
+func (array *FloatArray) Elements() []float64 {
+	var data *C.traeger_float_t
+	var size C.size_t
+	C.traeger_value_get_float_array(array.value.self, &data, &size)
+	if size == 0 {
+		return []float64{}
+	}
+	return unsafe.Slice((*float64)(unsafe.Pointer(data)), int(size))
+}
+
+func (array *FloatArray) Size() int {
+	var data *C.traeger_float_t
+	var size C.size_t
+	C.traeger_value_get_float_array(array.value.self, &data, &size)
+	return int(size)
+}
+
+func (array *FloatArray) Equal(other *FloatArray) bool {
+	return array.value.Equal(other.value)
+}
+
+// IntArray
+
+type IntArray struct {
+	value *Value
+}
+
+func FromIntArray(elements []int64) *IntArray {
+	value := NewValue()
+	value.SetIntArray(elements)
+	return &IntArray{value}
+}
+
+// Elements returns the elements of the array without copying them, the
+// slice is only valid while the array is reachable and must not be modified.
+func (array *IntArray) Elements() []int64 {
+	var data *C.traeger_int_t
+	var size C.size_t
+	C.traeger_value_get_int_array(array.value.self, &data, &size)
+	if size == 0 {
+		return []int64{}
+	}
+	return unsafe.Slice((*int64)(unsafe.Pointer(data)), int(size))
+}
+
+func (array *IntArray) Size() int {
+	var data *C.traeger_int_t
+	var size C.size_t
+	C.traeger_value_get_int_array(array.value.self, &data, &size)
+	return int(size)
+}
+
+func (array *IntArray) Equal(other *IntArray) bool {
+	return array.value.Equal(other.value)
+}
@@ -3,6 +3,7 @@
 #include <nanobind/stl/function.h>
 #include <nanobind/stl/string.h>
 #include <nanobind/stl/variant.h>
+#include <nanobind/stl/vector.h>
 
 #include <cstdint>
 #include <chrono>
@@ -35,6 +36,18 @@ namespace
         return Result{Error{std::move(error)}};
     }
 
+    auto result_is_timeout(const Result &self) -> bool
+    {
+        const auto *error = self.error();
+        return error != nullptr && error->is_timeout();
+    }
+
+    auto result_is_cancelled(const Result &self) -> bool
+    {
+        const auto *error = self.error();
+        return error != nullptr && error->is_cancelled();
+    }
+
     auto result_repr(const Result &self)
     {
         return type_repr("traeger.Result", self);
@@ -121,6 +134,18 @@ namespace
             });
     }
 
+    auto promise_with_timeout(const Promise &self,
+                              Float timeout) -> Promise
+    {
+        return self.with_timeout(to_microseconds(timeout));
+    }
+
+    auto promise_wait_for(const Promise &self,
+                          Float timeout) -> Result
+    {
+        return self.wait_for(to_microseconds(timeout));
+    }
+
     auto promise_repr(const Promise &self) -> String
     {
         return type_repr("traeger.Promise", self.result());
@@ -165,6 +190,8 @@ auto traeger_python_register_actor_types(nb::module_ &module) -> void
     result_class
         .def(nb::init<>())
         .def("__repr__", &result_repr)
+        .def("is_timeout", &result_is_timeout)
+        .def("is_cancelled", &result_is_cancelled)
         .def_static("from_value", &result_from_variant, nb::arg("value").none())
         .def_static("from_error", &result_from_error);
 
@@ -188,7 +215,15 @@ auto traeger_python_register_actor_types(nb::module_ &module) -> void
         .def("set", promise_set_result)
         .def("then_result", &promise_then_result)
         .def("then_promise", &promise_then_promise)
-        .def("fail", &promise_fail);
+        .def("fail", &promise_fail)
+        .def("with_timeout", &promise_with_timeout)
+        .def("cancel", &Promise::cancel)
+        .def("is_cancelled", &Promise::is_cancelled)
+        .def("wait", &Promise::wait, nb::call_guard<nb::gil_scoped_release>())
+        .def("wait_for", &promise_wait_for, nb::call_guard<nb::gil_scoped_release>())
+        .def_static("when_all", &Promise::when_all)
+        .def_static("when_any", &Promise::when_any)
+        .def_static("race", &Promise::race);
 
     queue_class
         .def(nb::init<>())
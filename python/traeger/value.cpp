@@ -1,9 +1,14 @@
 // SPDX-License-Identifier: BSL-1.0
 
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
 #include <utility>
 
+#include <nanobind/ndarray.h>
 #include <nanobind/stl/string.h>
 #include <nanobind/stl/variant.h>
+#include <nanobind/stl/optional.h>
 #include <nanobind/stl/pair.h>
 
 #include <traeger/value/Variant.hpp>
@@ -75,30 +80,23 @@ namespace
 
     auto list_from_sequence(nb::sequence sequence) -> List
     {
-        List result;
-        Variant variant;
-        Value value;
-        auto throw_error = []
-        {
-            throw nb::type_error(
-                "argument must be a Sequence[None | bool | int | float | str | traeger.List | traeger.Map]");
-        };
-        for (auto handle : sequence)
-        {
-            if (nb::try_cast(handle, variant))
-            {
-                result.append(value_from_variant(std::move(variant)));
-            }
-            else if (nb::try_cast(handle, value))
+        return List::from_range(
+            sequence.begin(), sequence.end(),
+            [](nb::handle handle) -> Value
             {
-                result.append(std::move(value));
-            }
-            else
-            {
-                throw_error();
-            }
-        }
-        return result;
+                Variant variant;
+                Value value;
+                if (nb::try_cast(handle, variant))
+                {
+                    return value_from_variant(std::move(variant));
+                }
+                if (nb::try_cast(handle, value))
+                {
+                    return value;
+                }
+                throw nb::type_error(
+                    "argument must be a Sequence[None | bool | int | float | str | bytes | traeger.List | traeger.Map | traeger.Blob | traeger.FloatArray | traeger.IntArray]");
+            });
     }
 
     auto list_init(List *self,
@@ -121,36 +119,32 @@ namespace
 
     auto map_from_mapping(nb::mapping mapping) -> Map
     {
-        Map result;
-        String key;
-        Variant variant;
-        Value value;
-        nb::handle value_handle;
         auto throw_error = []
         {
-            throw nb::type_error("argument must be a Mapping[str, None | bool | int | float | str | traeger.List | traeger.Map]");
+            throw nb::type_error("argument must be a Mapping[str, None | bool | int | float | str | bytes | traeger.List | traeger.Map | traeger.Blob | traeger.FloatArray | traeger.IntArray]");
         };
-        for (auto key_handle : mapping)
-        {
-            if (!nb::try_cast(key_handle, key))
+        return Map::from_pairs(
+            mapping.begin(), mapping.end(),
+            [&mapping, &throw_error](nb::handle key_handle) -> std::pair<Atom, Value>
             {
-                throw_error();
-            }
-            value_handle = mapping[key_handle];
-            if (nb::try_cast(value_handle, variant))
-            {
-                result.set(std::move(key), value_from_variant(std::move(variant)));
-            }
-            else if (nb::try_cast(value_handle, value))
-            {
-                result.set(std::move(key), std::move(value));
-            }
-            else
-            {
-                throw_error();
-            }
-        }
-        return result;
+                String key;
+                Variant variant;
+                Value value;
+                if (!nb::try_cast(key_handle, key))
+                {
+                    throw_error();
+                }
+                nb::handle value_handle = mapping[key_handle];
+                if (nb::try_cast(value_handle, variant))
+                {
+                    return {Atom{key}, value_from_variant(std::move(variant))};
+                }
+                if (!nb::try_cast(value_handle, value))
+                {
+                    throw_error();
+                }
+                return {Atom{key}, std::move(value)};
+            });
     }
 
     auto map_init(Map *self,
@@ -194,6 +188,35 @@ namespace
         }
     }
 
+    auto list_insert_value(List &self,
+                           Int index,
+                           const Value &value) -> void
+    {
+        if (!self.insert(index, value))
+        {
+            throw nb::index_error("index out of range");
+        }
+    }
+
+    auto list_insert_variant(List &self,
+                             Int index,
+                             const Variant &variant) -> void
+    {
+        if (!self.insert(index, value_from_variant(variant)))
+        {
+            throw nb::index_error("index out of range");
+        }
+    }
+
+    auto list_erase(List &self,
+                    Int index) -> void
+    {
+        if (!self.erase(index))
+        {
+            throw nb::index_error("index out of range");
+        }
+    }
+
     auto list_iter(const List &self) -> List::Iterator
     {
         return self.begin();
@@ -239,6 +262,18 @@ namespace
         self.set(key, value_from_variant(variant));
     }
 
+    auto map_contains(const Map &self,
+                      const String &key) -> bool
+    {
+        return self.contains(key);
+    }
+
+    auto map_erase(Map &self,
+                   const String &key) -> void
+    {
+        self.erase(key);
+    }
+
     auto map_key_iter(const Map &self)
     {
         return MapKeyIterator{self.begin()};
@@ -254,6 +289,128 @@ namespace
         return MapItemIterator{self.begin()};
     }
 
+    auto blob_init(Blob *self,
+                   nb::bytes bytes) -> void
+    {
+        new (self) Blob{std::string_view{bytes.c_str(), bytes.size()}};
+    }
+
+    auto blob_repr(const Blob &self) -> String
+    {
+        return type_repr("traeger.Blob", self);
+    }
+
+    auto blob_bytes(const Blob &self) -> nb::bytes
+    {
+        return nb::bytes(self.data(), self.size());
+    }
+
+    // A read only array sharing the bytes of the blob, it supports the
+    // buffer protocol so memoryview(blob.view()) does not copy.
+    auto blob_view(const Blob &self)
+    {
+        auto *owner = new Blob{self};
+        nb::capsule capsule{owner, [](void *blob) noexcept
+                            { delete static_cast<Blob *>(blob); }};
+        return nb::ndarray<const std::uint8_t, nb::ndim<1>, nb::c_contig>{
+            owner->data(), {owner->size()}, std::move(capsule)};
+    }
+
+    template <typename Element>
+    auto array_init(Array<Element> *self,
+                    nb::ndarray<const Element, nb::ndim<1>, nb::device::cpu> elements) -> void
+    {
+        const auto stride = elements.stride(0);
+        // A contiguous array is copied in one go by the range constructor.
+        if (stride == 1)
+        {
+            new (self) Array<Element>(elements.data(), elements.shape(0));
+            return;
+        }
+        new (self) Array<Element>{};
+        for (std::size_t n = 0; n < elements.shape(0); ++n)
+        {
+            self->append(elements.data()[n * stride]);
+        }
+    }
+
+    template <typename Element>
+    auto array_append(Array<Element> &self,
+                      const Element element) -> void
+    {
+        self.append(element);
+    }
+
+    template <typename Element>
+    auto array_get(const Array<Element> &self,
+                   const int index) -> Element
+    {
+        if (const auto optional = self.get(index); optional)
+        {
+            return optional.value();
+        }
+        throw nb::index_error();
+    }
+
+    template <typename Element>
+    auto array_set(Array<Element> &self,
+                   const int index,
+                   const Element element) -> void
+    {
+        if (!self.set(index, element))
+        {
+            throw nb::index_error();
+        }
+    }
+
+    template <typename Element>
+    auto array_repr(const Array<Element> &self) -> String
+    {
+        if constexpr (std::is_same_v<Element, Float>)
+        {
+            return type_repr("traeger.FloatArray", self);
+        }
+        else
+        {
+            return type_repr("traeger.IntArray", self);
+        }
+    }
+
+    // A read only NumPy array sharing the elements, the capsule keeps
+    // a copy of the array alive for as long as NumPy references it.
+    template <typename Element>
+    auto array_to_numpy(const Array<Element> &self)
+    {
+        auto *owner = new Array<Element>{self};
+        nb::capsule capsule{owner, [](void *array) noexcept
+                            { delete static_cast<Array<Element> *>(array); }};
+        return nb::ndarray<nb::numpy, const Element, nb::ndim<1>, nb::c_contig>{
+            owner->data(), {owner->size()}, std::move(capsule)};
+    }
+
+    template <typename Element>
+    auto array_register(nb::class_<Array<Element>> &array_class) -> void
+    {
+        array_class
+            .def(nb::init<>())
+            .def("__init__", &array_init<Element>)
+            .def("append", &array_append<Element>)
+            .def("copy", &type_copy<Array<Element>>)
+            .def("to_numpy", &array_to_numpy<Element>)
+            .def("sum", &Array<Element>::sum)
+            .def("min", &Array<Element>::min)
+            .def("max", &Array<Element>::max)
+            .def("dot", &Array<Element>::dot)
+            .def("__repr__", &array_repr<Element>)
+            .def("__str__", &type_str<Array<Element>>)
+            .def("__eq__", &Array<Element>::operator==)
+            .def("__ne__", &Array<Element>::operator!=)
+            .def("__len__", &Array<Element>::size)
+            .def("__bool__", &type_bool<Array<Element>>)
+            .def("__getitem__", &array_get<Element>)
+            .def("__setitem__", &array_set<Element>);
+    }
+
     auto value_init_from_variant(Value *self,
                                  const Variant &variant) -> void
     {
@@ -312,6 +469,9 @@ auto traeger_python_register_value_types(nb::module_ &module) -> void
     auto map_key_iterator_class = nb::class_<MapKeyIterator>(module, "Map_key_iterator");
     auto map_value_iterator_class = nb::class_<MapValueIterator>(module, "Map_value_iterator");
     auto map_item_iterator_class = nb::class_<MapItemIterator>(module, "Map_item_iterator");
+    auto blob_class = nb::class_<Blob>(module, "Blob");
+    auto float_array_class = nb::class_<FloatArray>(module, "FloatArray");
+    auto int_array_class = nb::class_<IntArray>(module, "IntArray");
     auto value_class = nb::class_<Value>(module, "Value");
     auto value_type_enum = nb::enum_<Value::Type>(value_class, "Type");
 
@@ -322,6 +482,12 @@ auto traeger_python_register_value_types(nb::module_ &module) -> void
         .def("append", &list_append_variant, nb::arg("value").none())
         .def("copy", &type_copy<List>)
         .def("resize", &List::resize)
+        .def("slice", &List::slice)
+        .def("concat", &List::concat)
+        .def("insert", &list_insert_value)
+        .def("insert", &list_insert_variant, nb::arg("index"), nb::arg("value").none())
+        .def("erase", &list_erase)
+        .def("__add__", &List::concat)
         .def("__repr__", &list_repr)
         .def("__str__", &type_str<List>)
         .def("__eq__", &List::operator==)
@@ -346,16 +512,34 @@ auto traeger_python_register_value_types(nb::module_ &module) -> void
         .def("__ne__", &Map::operator!=)
         .def("__len__", &Map::size)
         .def("__bool__", &type_bool<Map>)
-        .def("__contains__", &Map::contains)
+        .def("__contains__", &map_contains)
         .def("__getitem__", &map_find)
         .def("__setitem__", &map_set_value)
         .def("__setitem__", &map_set_variant, nb::arg("key"), nb::arg("value").none())
-        .def("__delitem__", &Map::erase)
+        .def("__delitem__", &map_erase)
         .def("__iter__", &map_key_iter)
         .def("keys", &map_key_iter)
         .def("values", &map_value_iter)
         .def("items", &map_item_iter);
 
+    blob_class
+        .def(nb::init<>())
+        .def("__init__", &blob_init)
+        .def("view", &blob_view)
+        .def("copy", &type_copy<Blob>)
+        .def("__bytes__", &blob_bytes)
+        .def("__repr__", &blob_repr)
+        .def("__str__", &type_str<Blob>)
+        .def("__eq__", &Blob::operator==)
+        .def("__ne__", &Blob::operator!=)
+        .def("__len__", &Blob::size)
+        .def("__bool__", &type_bool<Blob>);
+
+    nb::implicitly_convertible<nb::bytes, Blob>();
+
+    array_register(float_array_class);
+    array_register(int_array_class);
+
     map_key_iterator_class
         .def("__iter__", &MapKeyIterator::iter)
         .def("__next__", &MapKeyIterator::next);
@@ -392,5 +576,8 @@ auto traeger_python_register_value_types(nb::module_ &module) -> void
         .value("String", Value::Type::String)
         .value("List", Value::Type::List)
         .value("Map", Value::Type::Map)
+        .value("Blob", Value::Type::Blob)
+        .value("FloatArray", Value::Type::FloatArray)
+        .value("IntArray", Value::Type::IntArray)
         .def("__repr__", &value_type_repr);
 }
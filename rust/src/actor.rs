@@ -37,6 +37,15 @@ fn set_result(
             Variant::Map(map) => unsafe {
                 c::traeger_result_set_map(c_result, map.ptr);
             },
+            Variant::Blob(blob) => unsafe {
+                c::traeger_result_set_value(c_result, blob.value.ptr);
+            },
+            Variant::FloatArray(array) => unsafe {
+                c::traeger_result_set_value(c_result, array.value.ptr);
+            },
+            Variant::IntArray(array) => unsafe {
+                c::traeger_result_set_value(c_result, array.value.ptr);
+            },
         },
         Err(error) => unsafe {
             c::traeger_result_set_error(c_result, error.as_ptr(), error.len());
@@ -84,6 +93,14 @@ impl Result {
             }
         }
     }
+
+    pub fn is_timeout(&self) -> bool {
+        unsafe { c::traeger_result_is_timeout(self.ptr) }
+    }
+
+    pub fn is_cancelled(&self) -> bool {
+        unsafe { c::traeger_result_is_cancelled(self.ptr) }
+    }
 }
 
 impl Drop for Result {
@@ -298,6 +315,35 @@ impl Promise {
         }
     }
 
+    pub fn cancel(&self) -> bool {
+        unsafe { c::traeger_promise_cancel(self.ptr) }
+    }
+
+    pub fn is_cancelled(&self) -> bool {
+        unsafe { c::traeger_promise_is_cancelled(self.ptr) }
+    }
+
+    pub fn wait(&self) -> Result {
+        unsafe {
+            let mut ptr: *mut c::traeger_result_t = std::ptr::null_mut();
+            c::traeger_promise_wait(self.ptr, &mut ptr);
+            Result { ptr }
+        }
+    }
+
+    pub fn wait_for(&self, timeout: std::time::Duration) -> Option<Result> {
+        unsafe {
+            let mut ptr: *mut c::traeger_result_t = std::ptr::null_mut();
+            let ready = c::traeger_promise_wait_for(self.ptr, timeout.as_secs_f64(), &mut ptr);
+            let result = Result { ptr };
+            if ready {
+                Some(result)
+            } else {
+                None
+            }
+        }
+    }
+
     pub fn set(&self, result: std::result::Result<Variant, std::string::String>) -> bool {
         let mut res = Result::new();
         res.set(result);
@@ -310,6 +356,48 @@ impl Promise {
         }
     }
 
+    pub fn with_timeout(&self, timeout: std::time::Duration) -> Promise {
+        unsafe {
+            let ptr = c::traeger_promise_with_timeout(self.ptr, timeout.as_secs_f64());
+            Promise { ptr }
+        }
+    }
+
+    pub fn when_all(scheduler: &Scheduler, promises: &[&Promise]) -> Promise {
+        let c_promises: Vec<*const c::traeger_promise_t> = promises
+            .iter()
+            .map(|promise| promise.ptr as *const _)
+            .collect();
+        unsafe {
+            let ptr =
+                c::traeger_promise_when_all(scheduler.ptr, c_promises.as_ptr(), c_promises.len());
+            Promise { ptr }
+        }
+    }
+
+    pub fn when_any(scheduler: &Scheduler, promises: &[&Promise]) -> Promise {
+        let c_promises: Vec<*const c::traeger_promise_t> = promises
+            .iter()
+            .map(|promise| promise.ptr as *const _)
+            .collect();
+        unsafe {
+            let ptr =
+                c::traeger_promise_when_any(scheduler.ptr, c_promises.as_ptr(), c_promises.len());
+            Promise { ptr }
+        }
+    }
+
+    pub fn race(scheduler: &Scheduler, promises: &[&Promise]) -> Promise {
+        let c_promises: Vec<*const c::traeger_promise_t> = promises
+            .iter()
+            .map(|promise| promise.ptr as *const _)
+            .collect();
+        unsafe {
+            let ptr = c::traeger_promise_race(scheduler.ptr, c_promises.as_ptr(), c_promises.len());
+            Promise { ptr }
+        }
+    }
+
     pub fn then_result(
         &self,
         then: impl Fn(Value) -> std::result::Result<Variant, std::string::String> + 'static,
@@ -727,6 +815,9 @@ impl Push<&Variant> for Queue {
             Variant::String(string) => self.push(string.as_str()),
             Variant::List(list) => self.push(list),
             Variant::Map(map) => self.push(map),
+            Variant::Blob(blob) => self.push(&blob.value),
+            Variant::FloatArray(array) => self.push(&array.value),
+            Variant::IntArray(array) => self.push(&array.value),
         }
     }
 }
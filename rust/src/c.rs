@@ -102,6 +102,14 @@ extern "C" {
 
     pub fn traeger_list_append_map(c_self: *mut traeger_list_t, c_map: *const traeger_map_t);
 
+    pub fn traeger_list_append_value(c_self: *mut traeger_list_t, c_value: *const traeger_value_t);
+
+    pub fn traeger_list_append_blob(
+        c_self: *mut traeger_list_t,
+        c_blob_data: *const u8,
+        c_blob_size: usize,
+    );
+
     pub fn traeger_list_set_null(c_self: *mut traeger_list_t, index: i32);
 
     pub fn traeger_list_set_bool(c_self: *mut traeger_list_t, index: i32, value: bool);
@@ -131,6 +139,19 @@ extern "C" {
         c_map: *const traeger_map_t,
     );
 
+    pub fn traeger_list_set_value(
+        c_self: *mut traeger_list_t,
+        index: i32,
+        c_value: *const traeger_value_t,
+    );
+
+    pub fn traeger_list_set_blob(
+        c_self: *mut traeger_list_t,
+        index: i32,
+        c_blob_data: *const u8,
+        c_blob_size: usize,
+    );
+
     pub fn traeger_list_find(
         c_self: *const traeger_list_t,
         index: i32,
@@ -226,6 +247,21 @@ extern "C" {
         c_map: *const traeger_map_t,
     );
 
+    pub fn traeger_map_set_value(
+        c_self: *mut traeger_map_t,
+        c_key_data: *const u8,
+        c_key_size: usize,
+        c_value: *const traeger_value_t,
+    );
+
+    pub fn traeger_map_set_blob(
+        c_self: *mut traeger_map_t,
+        c_key_data: *const u8,
+        c_key_size: usize,
+        c_blob_data: *const u8,
+        c_blob_size: usize,
+    );
+
     pub fn traeger_map_find(
         c_self: *const traeger_map_t,
         c_key_data: *const u8,
@@ -302,6 +338,12 @@ extern "C" {
         map: *mut *mut traeger_map_t,
     ) -> bool;
 
+    pub fn traeger_value_get_blob(
+        c_self: *const traeger_value_t,
+        c_blob_data: *mut *const u8,
+        c_blob_size: *mut usize,
+    ) -> bool;
+
     pub fn traeger_value_set_null(c_self: *mut traeger_value_t);
 
     pub fn traeger_value_set_bool(c_self: *mut traeger_value_t, value: bool);
@@ -321,6 +363,38 @@ extern "C" {
     pub fn traeger_value_set_list(c_self: *mut traeger_value_t, c_list: *const traeger_list_t);
 
     pub fn traeger_value_set_map(c_self: *mut traeger_value_t, c_map: *const traeger_map_t);
+
+    pub fn traeger_value_set_value(c_self: *mut traeger_value_t, c_value: *const traeger_value_t);
+
+    pub fn traeger_value_set_blob(
+        c_self: *mut traeger_value_t,
+        c_blob_data: *const u8,
+        c_blob_size: usize,
+    );
+
+    pub fn traeger_value_set_float_array(
+        c_self: *mut traeger_value_t,
+        c_array_data: *const f64,
+        c_array_size: usize,
+    );
+
+    pub fn traeger_value_set_int_array(
+        c_self: *mut traeger_value_t,
+        c_array_data: *const i64,
+        c_array_size: usize,
+    );
+
+    pub fn traeger_value_get_float_array(
+        c_self: *const traeger_value_t,
+        c_array_data: *mut *const f64,
+        c_array_size: *mut usize,
+    ) -> bool;
+
+    pub fn traeger_value_get_int_array(
+        c_self: *const traeger_value_t,
+        c_array_data: *mut *const i64,
+        c_array_size: *mut usize,
+    ) -> bool;
 }
 
 #[allow(non_camel_case_types)]
@@ -410,6 +484,8 @@ extern "C" {
 
     pub fn traeger_result_set_map(c_self: *mut traeger_result_t, c_map: *const traeger_map_t);
 
+    pub fn traeger_result_set_value(c_self: *mut traeger_result_t, c_value: *const traeger_value_t);
+
     pub fn traeger_result_set_error(
         c_self: *mut traeger_result_t,
         c_error_data: *const u8,
@@ -422,6 +498,10 @@ extern "C" {
         c_error: *mut *mut traeger_string_t,
     ) -> u32;
 
+    pub fn traeger_result_is_timeout(c_self: *const traeger_result_t) -> bool;
+
+    pub fn traeger_result_is_cancelled(c_self: *const traeger_result_t) -> bool;
+
     // Function
 
     pub fn traeger_function_new(
@@ -485,6 +565,21 @@ extern "C" {
         c_result: *mut *mut traeger_result_t,
     );
 
+    pub fn traeger_promise_cancel(c_self: *const traeger_promise_t) -> bool;
+
+    pub fn traeger_promise_is_cancelled(c_self: *const traeger_promise_t) -> bool;
+
+    pub fn traeger_promise_wait(
+        c_self: *const traeger_promise_t,
+        c_result: *mut *mut traeger_result_t,
+    );
+
+    pub fn traeger_promise_wait_for(
+        c_self: *const traeger_promise_t,
+        timeout: f64,
+        c_result: *mut *mut traeger_result_t,
+    ) -> bool;
+
     pub fn traeger_promise_set_result(
         c_self: *const traeger_promise_t,
         c_result: *const traeger_result_t,
@@ -520,6 +615,29 @@ extern "C" {
         data_free: Option<extern "C" fn(*mut std::ffi::c_void)>,
     );
 
+    pub fn traeger_promise_with_timeout(
+        c_self: *const traeger_promise_t,
+        timeout: f64,
+    ) -> *mut traeger_promise_t;
+
+    pub fn traeger_promise_when_all(
+        c_scheduler: *const traeger_scheduler_t,
+        c_promises: *const *const traeger_promise_t,
+        promises_size: usize,
+    ) -> *mut traeger_promise_t;
+
+    pub fn traeger_promise_when_any(
+        c_scheduler: *const traeger_scheduler_t,
+        c_promises: *const *const traeger_promise_t,
+        promises_size: usize,
+    ) -> *mut traeger_promise_t;
+
+    pub fn traeger_promise_race(
+        c_scheduler: *const traeger_scheduler_t,
+        c_promises: *const *const traeger_promise_t,
+        promises_size: usize,
+    ) -> *mut traeger_promise_t;
+
     // Actor
 
     pub fn traeger_actor_new() -> *mut traeger_actor_t;
@@ -25,6 +25,9 @@ pub enum Variant {
     String(String),
     List(List),
     Map(Map),
+    Blob(Blob),
+    FloatArray(FloatArray),
+    IntArray(IntArray),
 }
 
 // String
@@ -248,6 +251,38 @@ impl Append<&Map> for List {
     }
 }
 
+impl Append<&[u8]> for List {
+    fn append(&mut self, bytes: &[u8]) {
+        unsafe {
+            c::traeger_list_append_blob(self.ptr, bytes.as_ptr(), bytes.len());
+        }
+    }
+}
+
+impl Append<&Blob> for List {
+    fn append(&mut self, blob: &Blob) {
+        unsafe {
+            c::traeger_list_append_value(self.ptr, blob.value.ptr);
+        }
+    }
+}
+
+impl Append<&FloatArray> for List {
+    fn append(&mut self, array: &FloatArray) {
+        unsafe {
+            c::traeger_list_append_value(self.ptr, array.value.ptr);
+        }
+    }
+}
+
+impl Append<&IntArray> for List {
+    fn append(&mut self, array: &IntArray) {
+        unsafe {
+            c::traeger_list_append_value(self.ptr, array.value.ptr);
+        }
+    }
+}
+
 impl Append<Variant> for List {
     fn append(&mut self, variant: Variant) {
         match variant {
@@ -259,6 +294,9 @@ impl Append<Variant> for List {
             Variant::String(string) => self.append(string.as_str()),
             Variant::List(list) => self.append(&list),
             Variant::Map(map) => self.append(&map),
+            Variant::Blob(blob) => self.append(&blob),
+            Variant::FloatArray(array) => self.append(&array),
+            Variant::IntArray(array) => self.append(&array),
         }
     }
 }
@@ -343,6 +381,38 @@ impl SetIndex<&Map> for List {
     }
 }
 
+impl SetIndex<&[u8]> for List {
+    fn set(&mut self, index: i32, bytes: &[u8]) {
+        unsafe {
+            c::traeger_list_set_blob(self.ptr, index, bytes.as_ptr(), bytes.len());
+        }
+    }
+}
+
+impl SetIndex<&Blob> for List {
+    fn set(&mut self, index: i32, blob: &Blob) {
+        unsafe {
+            c::traeger_list_set_value(self.ptr, index, blob.value.ptr);
+        }
+    }
+}
+
+impl SetIndex<&FloatArray> for List {
+    fn set(&mut self, index: i32, array: &FloatArray) {
+        unsafe {
+            c::traeger_list_set_value(self.ptr, index, array.value.ptr);
+        }
+    }
+}
+
+impl SetIndex<&IntArray> for List {
+    fn set(&mut self, index: i32, array: &IntArray) {
+        unsafe {
+            c::traeger_list_set_value(self.ptr, index, array.value.ptr);
+        }
+    }
+}
+
 impl SetIndex<Variant> for List {
     fn set(&mut self, index: i32, variant: Variant) {
         match variant {
@@ -354,6 +424,9 @@ impl SetIndex<Variant> for List {
             Variant::String(string) => self.set(index, string.as_str()),
             Variant::List(list) => self.set(index, &list),
             Variant::Map(map) => self.set(index, &map),
+            Variant::Blob(blob) => self.set(index, &blob),
+            Variant::FloatArray(array) => self.set(index, &array),
+            Variant::IntArray(array) => self.set(index, &array),
         }
     }
 }
@@ -589,6 +662,44 @@ impl SetKey<&Map> for Map {
     }
 }
 
+impl SetKey<&[u8]> for Map {
+    fn set(&mut self, key: &str, bytes: &[u8]) {
+        unsafe {
+            c::traeger_map_set_blob(
+                self.ptr,
+                key.as_ptr(),
+                key.len(),
+                bytes.as_ptr(),
+                bytes.len(),
+            );
+        }
+    }
+}
+
+impl SetKey<&Blob> for Map {
+    fn set(&mut self, key: &str, blob: &Blob) {
+        unsafe {
+            c::traeger_map_set_value(self.ptr, key.as_ptr(), key.len(), blob.value.ptr);
+        }
+    }
+}
+
+impl SetKey<&FloatArray> for Map {
+    fn set(&mut self, key: &str, array: &FloatArray) {
+        unsafe {
+            c::traeger_map_set_value(self.ptr, key.as_ptr(), key.len(), array.value.ptr);
+        }
+    }
+}
+
+impl SetKey<&IntArray> for Map {
+    fn set(&mut self, key: &str, array: &IntArray) {
+        unsafe {
+            c::traeger_map_set_value(self.ptr, key.as_ptr(), key.len(), array.value.ptr);
+        }
+    }
+}
+
 impl SetKey<Variant> for Map {
     fn set(&mut self, key: &str, variant: Variant) {
         match variant {
@@ -600,6 +711,9 @@ impl SetKey<Variant> for Map {
             Variant::String(string) => self.set(key, string.as_str()),
             Variant::List(list) => self.set(key, &list),
             Variant::Map(map) => self.set(key, &map),
+            Variant::Blob(blob) => self.set(key, &blob),
+            Variant::FloatArray(array) => self.set(key, &array),
+            Variant::IntArray(array) => self.set(key, &array),
         }
     }
 }
@@ -712,6 +826,9 @@ impl Value {
         const STRING: u32 = 5;
         const LIST: u32 = 6;
         const MAP: u32 = 7;
+        const BLOB: u32 = 8;
+        const FLOAT_ARRAY: u32 = 9;
+        const INT_ARRAY: u32 = 10;
         unsafe {
             match c::traeger_value_get_type(self.ptr) {
                 BOOL => {
@@ -752,6 +869,15 @@ impl Value {
                     let map = Map { ptr };
                     Variant::Map(map)
                 }
+                BLOB => Variant::Blob(Blob {
+                    value: self.clone(),
+                }),
+                FLOAT_ARRAY => Variant::FloatArray(FloatArray {
+                    value: self.clone(),
+                }),
+                INT_ARRAY => Variant::IntArray(IntArray {
+                    value: self.clone(),
+                }),
                 NULL | _ => Variant::Null,
             }
         }
@@ -877,6 +1003,54 @@ impl Get<Map> for Value {
     }
 }
 
+impl Get<Blob> for Value {
+    fn get(&self) -> Option<Blob> {
+        unsafe {
+            let mut data: *const u8 = std::ptr::null();
+            let mut size: usize = 0;
+            if c::traeger_value_get_blob(self.ptr, &mut data, &mut size) {
+                Some(Blob {
+                    value: self.clone(),
+                })
+            } else {
+                None
+            }
+        }
+    }
+}
+
+impl Get<FloatArray> for Value {
+    fn get(&self) -> Option<FloatArray> {
+        unsafe {
+            let mut data: *const f64 = std::ptr::null();
+            let mut size: usize = 0;
+            if c::traeger_value_get_float_array(self.ptr, &mut data, &mut size) {
+                Some(FloatArray {
+                    value: self.clone(),
+                })
+            } else {
+                None
+            }
+        }
+    }
+}
+
+impl Get<IntArray> for Value {
+    fn get(&self) -> Option<IntArray> {
+        unsafe {
+            let mut data: *const i64 = std::ptr::null();
+            let mut size: usize = 0;
+            if c::traeger_value_get_int_array(self.ptr, &mut data, &mut size) {
+                Some(IntArray {
+                    value: self.clone(),
+                })
+            } else {
+                None
+            }
+        }
+    }
+}
+
 impl Get<Variant> for Value {
     fn get(&self) -> Option<Variant> {
         Some(self.to_variant())
@@ -963,6 +1137,54 @@ impl Set<&Map> for Value {
     }
 }
 
+impl Set<&[u8]> for Value {
+    fn set(&mut self, bytes: &[u8]) {
+        unsafe {
+            c::traeger_value_set_blob(self.ptr, bytes.as_ptr(), bytes.len());
+        }
+    }
+}
+
+impl Set<&Blob> for Value {
+    fn set(&mut self, blob: &Blob) {
+        unsafe {
+            c::traeger_value_set_value(self.ptr, blob.value.ptr);
+        }
+    }
+}
+
+impl Set<&[Float]> for Value {
+    fn set(&mut self, elements: &[Float]) {
+        unsafe {
+            c::traeger_value_set_float_array(self.ptr, elements.as_ptr(), elements.len());
+        }
+    }
+}
+
+impl Set<&FloatArray> for Value {
+    fn set(&mut self, array: &FloatArray) {
+        unsafe {
+            c::traeger_value_set_value(self.ptr, array.value.ptr);
+        }
+    }
+}
+
+impl Set<&[Int]> for Value {
+    fn set(&mut self, elements: &[Int]) {
+        unsafe {
+            c::traeger_value_set_int_array(self.ptr, elements.as_ptr(), elements.len());
+        }
+    }
+}
+
+impl Set<&IntArray> for Value {
+    fn set(&mut self, array: &IntArray) {
+        unsafe {
+            c::traeger_value_set_value(self.ptr, array.value.ptr);
+        }
+    }
+}
+
 impl Set<Variant> for Value {
     fn set(&mut self, variant: Variant) {
         match variant {
@@ -974,6 +1196,9 @@ impl Set<Variant> for Value {
             Variant::String(string) => self.set(string.as_str()),
             Variant::List(list) => self.set(&list),
             Variant::Map(map) => self.set(&map),
+            Variant::Blob(blob) => self.set(&blob),
+            Variant::FloatArray(array) => self.set(&array),
+            Variant::IntArray(array) => self.set(&array),
         }
     }
 }
@@ -1024,6 +1249,171 @@ impl PartialEq for Value {
     }
 }
 
+// Blob
+
+#[derive(Clone, PartialEq)]
+pub struct Blob {
+    pub(crate) value: Value,
+}
+
+impl Blob {
+    pub fn new(bytes: &[u8]) -> Self {
+        Blob {
+            value: Value::from(bytes),
+        }
+    }
+
+    pub fn len(&self) -> usize {
+        self.as_slice().len()
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+
+    // The bytes are borrowed from the blob, they are never copied.
+    pub fn as_slice(&self) -> &[u8] {
+        unsafe {
+            let mut data: *const u8 = std::ptr::null();
+            let mut size: usize = 0;
+            c::traeger_value_get_blob(self.value.ptr, &mut data, &mut size);
+            if size == 0 {
+                &[]
+            } else {
+                std::slice::from_raw_parts(data, size)
+            }
+        }
+    }
+}
+
+impl From<&[u8]> for Blob {
+    fn from(bytes: &[u8]) -> Self {
+        Blob::new(bytes)
+    }
+}
+
+impl std::fmt::Display for Blob {
+    fn fmt(&self, f: &mut std::fmt::Formatter) -> std::fmt::Result {
+        std::fmt::Display::fmt(&self.value, f)
+    }
+}
+
+impl std::fmt::Debug for Blob {
+    fn fmt(&self, f: &mut std::fmt::Formatter) -> std::fmt::Result {
+        std::fmt::Debug::fmt(&self.value, f)
+    }
+}
+
+// FloatArray
+
+#[derive(Clone, PartialEq)]
+pub struct FloatArray {
+    pub(crate) value: Value,
+}
+
+impl FloatArray {
+    pub fn new(elements: &[Float]) -> Self {
+        FloatArray {
+            value: Value::from(elements),
+        }
+    }
+
+    pub fn len(&self) -> usize {
+        self.as_slice().len()
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+
+    // The elements are borrowed from the array, they are never copied.
+    pub fn as_slice(&self) -> &[Float] {
+        unsafe {
+            let mut data: *const f64 = std::ptr::null();
+            let mut size: usize = 0;
+            c::traeger_value_get_float_array(self.value.ptr, &mut data, &mut size);
+            if size == 0 {
+                &[]
+            } else {
+                std::slice::from_raw_parts(data, size)
+            }
+        }
+    }
+}
+
+impl From<&[Float]> for FloatArray {
+    fn from(elements: &[Float]) -> Self {
+        FloatArray::new(elements)
+    }
+}
+
+impl std::fmt::Display for FloatArray {
+    fn fmt(&self, f: &mut std::fmt::Formatter) -> std::fmt::Result {
+        std::fmt::Display::fmt(&self.value, f)
+    }
+}
+
+impl std::fmt::Debug for FloatArray {
+    fn fmt(&self, f: &mut std::fmt::Formatter) -> std::fmt::Result {
+        std::fmt::Debug::fmt(&self.value, f)
+    }
+}
+
+// IntArray
+
+#[derive(Clone, PartialEq)]
+pub struct IntArray {
+    pub(crate) value: Value,
+}
+
+impl IntArray {
+    pub fn new(elements: &[Int]) -> Self {
+        IntArray {
+            value: Value::from(elements),
+        }
+    }
+
+    pub fn len(&self) -> usize {
+        self.as_slice().len()
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+
+    // The elements are borrowed from the array, they are never copied.
+    pub fn as_slice(&self) -> &[Int] {
+        unsafe {
+            let mut data: *const i64 = std::ptr::null();
+            let mut size: usize = 0;
+            c::traeger_value_get_int_array(self.value.ptr, &mut data, &mut size);
+            if size == 0 {
+                &[]
+            } else {
+                std::slice::from_raw_parts(data, size)
+            }
+        }
+    }
+}
+
+impl From<&[Int]> for IntArray {
+    fn from(elements: &[Int]) -> Self {
+        IntArray::new(elements)
+    }
+}
+
+impl std::fmt::Display for IntArray {
+    fn fmt(&self, f: &mut std::fmt::Formatter) -> std::fmt::Result {
+        std::fmt::Display::fmt(&self.value, f)
+    }
+}
+
+impl std::fmt::Debug for IntArray {
+    fn fmt(&self, f: &mut std::fmt::Formatter) -> std::fmt::Result {
+        std::fmt::Debug::fmt(&self.value, f)
+    }
+}
+
 #[macro_export]
 macro_rules! list {
     ( $($value:expr),* ) => {{
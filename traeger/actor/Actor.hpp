@@ -11,6 +11,7 @@
 #include <utility>
 #include <variant>
 
+#include <traeger/value/Convert.hpp>
 #include <traeger/actor/Promise.hpp>
 #include <traeger/actor/Mailbox.hpp>
 #include <traeger/actor/StatelessActor.hpp>
@@ -21,8 +22,9 @@ namespace traeger
     {
         struct Promise : traeger::Promise
         {
-            template <typename Callback>
-            auto then(Callback &&then_callback) const noexcept -> traeger::Promise
+            template <typename Callback, typename... Policy>
+            auto then(Callback &&then_callback,
+                      Policy &&...policy) const noexcept -> traeger::Promise
             {
                 using CallbackResultType = std::invoke_result_t<Callback, Value>;
                 return traeger::Promise::then(
@@ -44,7 +46,8 @@ namespace traeger
                         {
                             return Result{Error{e.what()}};
                         }
-                    });
+                    },
+                    std::forward<Policy>(policy)...);
             }
         };
 
@@ -66,6 +69,120 @@ namespace traeger
         }
     };
 
+    template <typename State>
+    struct TypedMailbox
+    {
+        TypedMailbox(const std::shared_ptr<State> &state,
+                     const StatelessActor::Executor &executor) noexcept
+            : state_(state),
+              executor_(executor)
+        {
+        }
+
+        template <typename Return, typename... Params, typename... Args>
+        auto call(const Scheduler &scheduler,
+                  Return (State::*method)(Params...),
+                  Args &&...args) const noexcept -> Actor::Promise
+        {
+            return call_writer<Return, decltype(method), Params...>(scheduler, method, std::forward<Args>(args)...);
+        }
+
+        template <typename Return, typename... Params, typename... Args>
+        auto call(const Scheduler &scheduler,
+                  Return (State::*method)(Params...) noexcept,
+                  Args &&...args) const noexcept -> Actor::Promise
+        {
+            return call_writer<Return, decltype(method), Params...>(scheduler, method, std::forward<Args>(args)...);
+        }
+
+        template <typename Return, typename... Params, typename... Args>
+        auto call(const Scheduler &scheduler,
+                  Return (State::*method)(Params...) const,
+                  Args &&...args) const noexcept -> Actor::Promise
+        {
+            return call_reader<Return, decltype(method), Params...>(scheduler, method, std::forward<Args>(args)...);
+        }
+
+        template <typename Return, typename... Params, typename... Args>
+        auto call(const Scheduler &scheduler,
+                  Return (State::*method)(Params...) const noexcept,
+                  Args &&...args) const noexcept -> Actor::Promise
+        {
+            return call_reader<Return, decltype(method), Params...>(scheduler, method, std::forward<Args>(args)...);
+        }
+
+    private:
+        template <typename Return, typename Method, typename... Params, typename... Args>
+        auto call_writer(const Scheduler &scheduler,
+                         Method method,
+                         Args &&...args) const noexcept -> Actor::Promise
+        {
+            auto promise = Actor::Promise{traeger::Promise{scheduler}};
+            executor_.schedule_writer(scheduler, make_work<Return, Method, Params...>(promise, method, std::forward<Args>(args)...));
+            return promise;
+        }
+
+        template <typename Return, typename Method, typename... Params, typename... Args>
+        auto call_reader(const Scheduler &scheduler,
+                         Method method,
+                         Args &&...args) const noexcept -> Actor::Promise
+        {
+            auto promise = Actor::Promise{traeger::Promise{scheduler}};
+            executor_.schedule_reader(scheduler, make_work<Return, Method, Params...>(promise, method, std::forward<Args>(args)...));
+            return promise;
+        }
+
+        template <typename Method, typename Tuple, std::size_t... index, typename... Params>
+        static auto invoke_method(Method method,
+                                  State &state,
+                                  Tuple &tuple,
+                                  std::index_sequence<index...>,
+                                  std::tuple<Params...> *)
+        {
+            return std::invoke(method, state, static_cast<Params &&>(std::get<index>(tuple))...);
+        }
+
+        template <typename Return, typename Method, typename... Params, typename... Args>
+        auto make_work(const traeger::Promise &promise,
+                       Method method,
+                       Args &&...args) const noexcept -> Work
+        {
+            static_assert(sizeof...(Params) == sizeof...(Args), "wrong number of arguments");
+            using Tuple = std::tuple<std::decay_t<Params>...>;
+            return [promise,
+                    state = state_,
+                    method,
+                    arguments = Tuple{std::forward<Args>(args)...}]() mutable noexcept
+            {
+                if (promise.has_result())
+                {
+                    return;
+                }
+                try
+                {
+                    const auto sequence = std::index_sequence_for<Params...>();
+                    auto *params = static_cast<std::tuple<Params...> *>(nullptr);
+                    if constexpr (std::is_same_v<Return, void>)
+                    {
+                        invoke_method(method, *state, arguments, sequence, params);
+                        promise.set_result(Result{Value{}});
+                    }
+                    else
+                    {
+                        promise.set_result(Result{Value{invoke_method(method, *state, arguments, sequence, params)}});
+                    }
+                }
+                catch (const std::exception &e)
+                {
+                    promise.set_result(Result{Error{e.what()}});
+                }
+            };
+        }
+
+        std::shared_ptr<State> state_;
+        StatelessActor::Executor executor_;
+    };
+
     template <typename State>
     struct StatefulActor : Actor
     {
@@ -139,6 +256,11 @@ namespace traeger
             define(name, std::forward<Lambda>(lambda), &Lambda::operator());
         }
 
+        auto typed_mailbox() const noexcept -> TypedMailbox<State>
+        {
+            return TypedMailbox<State>{state_, StatelessActor::executor()};
+        }
+
     private:
         template <typename Lambda, typename Return, typename... Args>
         auto define(const String &name,
@@ -181,37 +303,49 @@ namespace traeger
             return std::invoke(std::forward<Func>(func), state, std::get<index>(std::forward<Tuple>(tuple))...);
         }
 
+        template <typename Return, typename Func, typename Tuple>
+        static auto invoke_result(Func &func,
+                                  State &state,
+                                  Tuple &&tuple) -> Result
+        {
+            constexpr auto sequence = std::make_integer_sequence<int, std::tuple_size_v<std::decay_t<Tuple>>>();
+            if constexpr (std::is_same_v<Return, void>)
+            {
+                invoke_func(func, state, std::forward<Tuple>(tuple), sequence);
+                return Result{Value{}};
+            }
+            else
+            {
+                return Result{Value{invoke_func(func, state, std::forward<Tuple>(tuple), sequence)}};
+            }
+        }
+
         template <typename Return, typename Func, typename... Args>
         auto make_function(Func &&func) const noexcept -> Function
         {
             return [state = state_, func = std::forward<Func>(func)](const List &args) mutable noexcept -> Result
             {
-                try
+                auto [arguments, error] = args.template try_get_tuple<std::decay_t<Args>...>();
+                if (!arguments)
                 {
-                    using Tuple = std::tuple<Args...>;
-                    if constexpr (std::is_same_v<Return, void>)
+                    return Result{Error{error.message()}};
+                }
+
+                if constexpr (std::is_nothrow_invocable_v<Func &, State &, Args...>)
+                {
+                    return invoke_result<Return>(func, *state, std::move(arguments).value());
+                }
+                else
+                {
+                    try
                     {
-                        invoke_func<Func, Tuple>(
-                            std::forward<Func>(func),
-                            *state,
-                            args.get_tuple<Args...>(),
-                            std::make_integer_sequence<int, sizeof...(Args)>());
-                        return Result{Value{}};
+                        return invoke_result<Return>(func, *state, std::move(arguments).value());
                     }
-                    else
+                    catch (const std::exception &e)
                     {
-                        return Result{Value{
-                            invoke_func<Func, Tuple>(
-                                std::forward<Func>(func),
-                                *state,
-                                args.get_tuple<Args...>(),
-                                std::make_integer_sequence<int, sizeof...(Args)>())}};
+                        return Result{Error{e.what()}};
                     }
                 }
-                catch (const std::exception &e)
-                {
-                    return Result{Error{e.what()}};
-                }
             };
         }
 
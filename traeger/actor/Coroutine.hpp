@@ -0,0 +1,140 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+#include <coroutine>
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+#include <traeger/actor/Result.hpp>
+#include <traeger/actor/Scheduler.hpp>
+#include <traeger/actor/Promise.hpp>
+
+#define TRAEGER_COROUTINE 1
+
+namespace traeger
+{
+    // Suspends the coroutine until the promise has a result, then resumes it
+    // in a worker of the scheduler of the promise. The resumption is always
+    // scheduled, never run inline, so the coroutine cannot finish and destroy
+    // this awaiter while await_suspend is still registering it.
+    struct PromiseAwaiter
+    {
+        Promise promise;
+
+        auto await_ready() const noexcept -> bool
+        {
+            return promise.has_result();
+        }
+
+        auto await_suspend(std::coroutine_handle<> handle) const noexcept -> void
+        {
+            // A copy, the member goes away with the frame once resumed.
+            const auto awaited = promise;
+            awaited.on_result(
+                [handle](const Result &)
+                {
+                    handle.resume();
+                },
+                Promise::Execution::Schedule);
+        }
+
+        auto await_resume() const noexcept -> Result
+        {
+            return promise.result();
+        }
+    };
+
+    inline auto operator co_await(const Promise &promise) noexcept -> PromiseAwaiter
+    {
+        return PromiseAwaiter{promise};
+    }
+
+    // The return type of coroutines that take a Scheduler as their first
+    // argument (after the object, for member functions). The coroutine starts
+    // eagerly, and what it returns with co_return sets the promise.
+    struct Task : Promise
+    {
+        struct promise_type
+        {
+            template <typename... Args>
+            explicit promise_type(const Scheduler &scheduler,
+                                  Args &&...) noexcept
+                : promise_(scheduler)
+            {
+            }
+
+            template <typename Object,
+                      typename... Args,
+                      typename = std::enable_if_t<!std::is_convertible_v<Object, const Scheduler &>>>
+            explicit promise_type(Object &&,
+                                  const Scheduler &scheduler,
+                                  Args &&...) noexcept
+                : promise_(scheduler)
+            {
+            }
+
+            auto get_return_object() const noexcept -> Task
+            {
+                return Task{promise_};
+            }
+
+            auto initial_suspend() const noexcept -> std::suspend_never
+            {
+                return {};
+            }
+
+            auto final_suspend() const noexcept -> std::suspend_never
+            {
+                return {};
+            }
+
+            template <typename Object>
+            auto return_value(Object &&object) const noexcept -> void
+            {
+                using Type = std::decay_t<Object>;
+                if constexpr (std::is_same_v<Type, Result>)
+                {
+                    promise_.set_result(std::forward<Object>(object));
+                }
+                else if constexpr (std::is_same_v<Type, Error>)
+                {
+                    promise_.set_result(Result{std::forward<Object>(object)});
+                }
+                else
+                {
+                    promise_.set_result(Result{Value{std::forward<Object>(object)}});
+                }
+            }
+
+            auto unhandled_exception() const noexcept -> void
+            {
+                try
+                {
+                    std::rethrow_exception(std::current_exception());
+                }
+                catch (const std::exception &e)
+                {
+                    promise_.set_result(Result{Error{e.what()}});
+                }
+                catch (...)
+                {
+                    promise_.set_result(Result{Error{"unknown exception"}});
+                }
+            }
+
+        private:
+            Promise promise_;
+        };
+
+        explicit Task(const Promise &promise) noexcept
+            : Promise(promise)
+        {
+        }
+    };
+}
+
+#endif
@@ -16,4 +16,12 @@ namespace traeger
     {
         return interface_->send(scheduler, name, arguments);
     }
+
+    auto Mailbox::send(const Scheduler &scheduler,
+                       const String &name,
+                       const List &arguments,
+                       const Duration &timeout) const noexcept -> Promise
+    {
+        return interface_->send(scheduler, name, arguments).with_timeout(timeout);
+    }
 }
@@ -32,6 +32,11 @@ namespace traeger
                   const String &name,
                   const List &arguments) const noexcept -> Promise;
 
+        auto send(const Scheduler &scheduler,
+                  const String &name,
+                  const List &arguments,
+                  const Duration &timeout) const noexcept -> Promise;
+
     private:
         std::shared_ptr<Interface> interface_;
     };
@@ -0,0 +1,242 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "traeger/actor/Parallel.hpp"
+
+namespace
+{
+    using namespace traeger;
+
+    // Slices per thread, so a slow slice does not leave the others idle.
+    constexpr std::size_t slices_per_thread = 4;
+
+    template <typename Callable>
+    auto attempt(Callable &&callable) noexcept -> Result
+    {
+        try
+        {
+            return Result{Value{callable()}};
+        }
+        catch (const std::exception &e)
+        {
+            return Result{Error{e.what()}};
+        }
+        catch (...)
+        {
+            return Result{Error{"unknown exception"}};
+        }
+    }
+
+    auto split(const List &list) noexcept -> std::vector<List>
+    {
+        // Slices made of whole leaves share all of their nodes with the list.
+        const auto leaf_size = List::leaf_size();
+        const auto size = list.size();
+        const auto threads = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+        const auto slices_count = threads * slices_per_thread;
+        const auto leaves = ((size + slices_count - 1) / slices_count + leaf_size - 1) / leaf_size;
+        const auto slice_size = std::max<std::size_t>(1, leaves) * leaf_size;
+
+        std::vector<List> slices;
+        slices.reserve((size + slice_size - 1) / slice_size);
+        for (std::size_t first = 0; first < size; first += slice_size)
+        {
+            const auto last = std::min(first + slice_size, size);
+            slices.push_back(list.slice(static_cast<int>(first), static_cast<int>(last)));
+        }
+        return slices;
+    }
+
+    // Schedules work on every slice, resolves to the list of their results.
+    template <typename Work>
+    auto scatter(const Scheduler &scheduler,
+                 const List &list,
+                 Work &&work) noexcept -> Promise
+    {
+        const auto shared_work = std::make_shared<std::decay_t<Work>>(std::forward<Work>(work));
+        std::vector<Promise> promises;
+        for (auto &slice : split(list))
+        {
+            Promise promise{scheduler};
+            scheduler.schedule(
+                [promise, shared_work, slice = std::move(slice)]() noexcept
+                {
+                    promise.set_result(attempt([&]
+                                               { return (*shared_work)(slice); }));
+                });
+            promises.push_back(std::move(promise));
+        }
+        return Promise::when_all(scheduler, promises);
+    }
+
+    auto join(const Value &slices) noexcept -> Result
+    {
+        const auto results = slices.get_list().value();
+        List joined;
+        for (const auto &result : results)
+        {
+            joined = joined.concat(result.get_list().value());
+        }
+        return Result{Value{std::move(joined)}};
+    }
+}
+
+namespace traeger::parallel
+{
+    auto map(const Scheduler &scheduler,
+             const List &list,
+             Update &&update) noexcept -> Promise
+    {
+        return scatter(scheduler,
+                       list,
+                       [update = std::move(update)](const List &slice)
+                       {
+                           List mapped;
+                           for (const auto &value : slice)
+                           {
+                               mapped.append(update(value));
+                           }
+                           return mapped;
+                       })
+            .then(join);
+    }
+
+    auto filter(const Scheduler &scheduler,
+                const List &list,
+                Predicate &&predicate) noexcept -> Promise
+    {
+        return scatter(scheduler,
+                       list,
+                       [predicate = std::move(predicate)](const List &slice)
+                       {
+                           List filtered;
+                           for (const auto &value : slice)
+                           {
+                               if (predicate(value))
+                               {
+                                   filtered.append(value);
+                               }
+                           }
+                           return filtered;
+                       })
+            .then(join);
+    }
+
+    auto reduce(const Scheduler &scheduler,
+                const List &list,
+                const Value &initial,
+                Reducer &&reducer) noexcept -> Promise
+    {
+        const auto shared_reducer = std::make_shared<Reducer>(std::move(reducer));
+        return scatter(scheduler,
+                       list,
+                       [shared_reducer](const List &slice)
+                       {
+                           auto iterator = slice.begin();
+                           Value folded = *iterator;
+                           for (++iterator; iterator != List::end(); ++iterator)
+                           {
+                               folded = (*shared_reducer)(folded, *iterator);
+                           }
+                           return folded;
+                       })
+            .then(
+                [shared_reducer, initial](const Value &partials) noexcept
+                {
+                    return attempt(
+                        [&]
+                        {
+                            const auto results = partials.get_list().value();
+                            Value folded = initial;
+                            for (const auto &partial : results)
+                            {
+                                folded = (*shared_reducer)(folded, partial);
+                            }
+                            return folded;
+                        });
+                });
+    }
+
+    auto sort(const Scheduler &scheduler,
+              const List &list,
+              Less &&less) noexcept -> Promise
+    {
+        const auto shared_less = std::make_shared<Less>(std::move(less));
+        return scatter(scheduler,
+                       list,
+                       [shared_less](const List &slice)
+                       {
+                           std::vector<Value> values;
+                           values.reserve(slice.size());
+                           for (const auto &value : slice)
+                           {
+                               values.push_back(value);
+                           }
+                           std::stable_sort(values.begin(), values.end(), std::ref(*shared_less));
+                           return List::from_range(std::move(values));
+                       })
+            .then(
+                [shared_less](const Value &slices) noexcept
+                {
+                    return attempt(
+                        [&]
+                        {
+                            const auto results = slices.get_list().value();
+                            std::vector<Value> values;
+                            std::vector<std::size_t> bounds{0};
+                            for (const auto &result : results)
+                            {
+                                const auto sorted = result.get_list().value();
+                                for (const auto &value : sorted)
+                                {
+                                    values.push_back(value);
+                                }
+                                bounds.push_back(values.size());
+                            }
+                            // Merges neighbouring runs until a single one is left,
+                            // the left run goes first to keep the sort stable.
+                            for (std::size_t step = 1; step + 1 < bounds.size(); step *= 2)
+                            {
+                                for (std::size_t index = 0; index + step + 1 < bounds.size(); index += 2 * step)
+                                {
+                                    const auto last = std::min(index + 2 * step, bounds.size() - 1);
+                                    std::inplace_merge(values.begin() + bounds[index],
+                                                       values.begin() + bounds[index + step],
+                                                       values.begin() + bounds[last],
+                                                       std::ref(*shared_less));
+                                }
+                            }
+                            return List::from_range(std::move(values));
+                        });
+                });
+    }
+
+    auto for_each(const Scheduler &scheduler,
+                  const List &list,
+                  Visitor &&visitor) noexcept -> Promise
+    {
+        return scatter(scheduler,
+                       list,
+                       [visitor = std::move(visitor)](const List &slice)
+                       {
+                           for (const auto &value : slice)
+                           {
+                               visitor(value);
+                           }
+                           return Value{};
+                       })
+            .then(
+                [](const Value &) noexcept
+                {
+                    return Result{Value{}};
+                });
+    }
+}
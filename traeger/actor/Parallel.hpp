@@ -0,0 +1,53 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <functional>
+
+#include <traeger/value/Value.hpp>
+#include <traeger/actor/Promise.hpp>
+#include <traeger/actor/Scheduler.hpp>
+
+namespace traeger::parallel
+{
+    using Predicate = std::function<bool(const Value &)>;
+
+    using Reducer = std::function<Value(const Value &, const Value &)>;
+
+    using Less = std::function<bool(const Value &, const Value &)>;
+
+    using Visitor = std::function<void(const Value &)>;
+
+    // The list is split in slices that share their nodes with it, each slice
+    // is processed as a work of the scheduler and the results are joined once
+    // all of them are done. The callbacks run concurrently, so they must not
+    // share mutable state, and an exception thrown by one of them becomes the
+    // error of the promise.
+
+    // Resolves to the list of the values returned by update.
+    auto map(const Scheduler &scheduler,
+             const List &list,
+             Update &&update) noexcept -> Promise;
+
+    // Resolves to the list of the values accepted by predicate, in order.
+    auto filter(const Scheduler &scheduler,
+                const List &list,
+                Predicate &&predicate) noexcept -> Promise;
+
+    // Resolves to the fold of the list starting from initial. Each slice is
+    // folded on its own, so reducer must be associative.
+    auto reduce(const Scheduler &scheduler,
+                const List &list,
+                const Value &initial,
+                Reducer &&reducer) noexcept -> Promise;
+
+    // Resolves to the list sorted by less, the sort is stable.
+    auto sort(const Scheduler &scheduler,
+              const List &list,
+              Less &&less) noexcept -> Promise;
+
+    // Resolves to null once visitor has been called on every value.
+    auto for_each(const Scheduler &scheduler,
+                  const List &list,
+                  Visitor &&visitor) noexcept -> Promise;
+}
@@ -0,0 +1,26 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <cstddef>
+
+#include "traeger/actor/Pool.hpp"
+#include "traeger/value/Memory_impl.hpp"
+
+namespace traeger
+{
+    // Promise states and socket closures share the blocks of the immer
+    // nodes, one allocator for both instead of two caches per thread.
+    auto Pool::allocate(const std::size_t size) noexcept -> void *
+    {
+        return pool_heap::allocate_block(size);
+    }
+
+    auto Pool::deallocate(void *pointer, const std::size_t size) noexcept -> void
+    {
+        pool_heap::deallocate_block(size, pointer);
+    }
+
+    auto Pool::cached(const std::size_t size) noexcept -> std::size_t
+    {
+        return pool_heap::cached_blocks(size);
+    }
+}
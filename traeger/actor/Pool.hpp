@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace traeger
+{
+    // Per-thread free lists of small blocks, the same ones behind the pool
+    // memory policy of the values. Blocks released by a thread are reused by
+    // the next allocations of the same size class, in that thread or, once
+    // a magazine fills up, in another one.
+    struct Pool
+    {
+        Pool() = delete;
+
+        static auto allocate(std::size_t size) noexcept -> void *;
+
+        static auto deallocate(void *pointer, std::size_t size) noexcept -> void;
+
+        static auto cached(std::size_t size) noexcept -> std::size_t;
+    };
+
+    template <typename Object>
+    struct PoolAllocator
+    {
+        static_assert(alignof(Object) <= alignof(std::max_align_t));
+
+        using value_type = Object;
+
+        PoolAllocator() noexcept = default;
+
+        template <typename Other>
+        PoolAllocator(const PoolAllocator<Other> &) noexcept
+        {
+        }
+
+        auto allocate(std::size_t count) const noexcept -> Object *
+        {
+            return static_cast<Object *>(Pool::allocate(count * sizeof(Object)));
+        }
+
+        auto deallocate(Object *pointer, std::size_t count) const noexcept -> void
+        {
+            Pool::deallocate(pointer, count * sizeof(Object));
+        }
+
+        template <typename Other>
+        auto operator==(const PoolAllocator<Other> &) const noexcept -> bool
+        {
+            return true;
+        }
+
+        template <typename Other>
+        auto operator!=(const PoolAllocator<Other> &) const noexcept -> bool
+        {
+            return false;
+        }
+    };
+
+    template <typename Object, typename... Args>
+    auto make_pooled(Args &&...args) noexcept -> std::shared_ptr<Object>
+    {
+        return std::allocate_shared<Object>(PoolAllocator<Object>{}, std::forward<Args>(args)...);
+    }
+}
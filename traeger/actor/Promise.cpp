@@ -1,136 +1,521 @@
 // SPDX-License-Identifier: BSL-1.0
 
-#include <mutex>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
 #include <functional>
+#include <mutex>
+#include <new>
+#include <optional>
 #include <utility>
-#include <queue>
+#include <vector>
 #include <memory>
 
 #include "traeger/actor/Result.hpp"
+#include "traeger/actor/Pool.hpp"
 #include "traeger/actor/Promise.hpp"
 
 namespace traeger
 {
-    struct Promise::impl_type
+    struct Promise::impl_type : std::enable_shared_from_this<Promise::impl_type>
     {
+        using callback_type = std::function<void(const Result &)>;
+
+        enum class dispatch_type : int
+        {
+            SCHEDULE = 0,
+            INLINE = 1,
+            SYNCHRONOUS = 2,
+        };
+
+        struct continuation_type
+        {
+            Scheduler scheduler;
+            dispatch_type dispatch;
+            bool only_error;
+            callback_type callback;
+        };
+
+        static auto to_dispatch(const Execution execution) noexcept -> dispatch_type
+        {
+            switch (execution)
+            {
+            case Execution::Inline:
+                return dispatch_type::INLINE;
+            case Execution::Schedule:
+                break;
+            }
+            return dispatch_type::SCHEDULE;
+        }
+
+        struct node_type
+        {
+            continuation_type continuation;
+            node_type *next;
+        };
+
+        enum class state_type : int
+        {
+            PENDING = 0,
+            SETTING = 1,
+            READY = 2,
+        };
+
+        ~impl_type() noexcept
+        {
+            auto *node = head_.load(std::memory_order_acquire);
+            while (node != nullptr && node != closed())
+            {
+                auto *next = node->next;
+                release(node);
+                node = next;
+            }
+            delete observers_.load(std::memory_order_acquire);
+        }
+
         explicit impl_type(Scheduler scheduler) noexcept
-            : scheduler_(std::move(scheduler))
+            : scheduler_(std::move(scheduler)),
+              state_(state_type::PENDING),
+              head_(nullptr),
+              observers_(nullptr),
+              dependents_(0)
         {
         }
 
         auto set(Result &&result) noexcept -> bool
         {
-            std::lock_guard lock{mutex_};
-            if (result_.type() == Result::Type::Undefined)
+            auto expected = state_type::PENDING;
+            if (!state_.compare_exchange_strong(expected,
+                                                state_type::SETTING,
+                                                std::memory_order_acquire,
+                                                std::memory_order_relaxed))
+            {
+                return false;
+            }
+            result_ = std::move(result);
+            const auto *error = result_.error();
+            cancelled_ = error != nullptr && error->is_cancelled();
+            state_.store(state_type::READY, std::memory_order_release);
+
+            // The callbacks were pushed in reverse order.
+            node_type *reversed = nullptr;
+            for (auto *node = head_.exchange(closed(), std::memory_order_acq_rel);
+                 node != nullptr;)
+            {
+                auto *next = node->next;
+                node->next = reversed;
+                reversed = node;
+                node = next;
+            }
+
+            while (reversed != nullptr)
             {
-                result_ = std::move(result);
-                schedule_callbacks();
-                return true;
+                auto *next = reversed->next;
+                dispatch(std::move(reversed->continuation));
+                release(reversed);
+                reversed = next;
             }
-            return false;
+            return true;
         }
 
-        auto then(ResultCallback &&result_callback) noexcept -> Promise
+        auto then(ResultCallback &&result_callback,
+                  const Scheduler &scheduler,
+                  const Execution execution) noexcept -> Promise
         {
-            std::lock_guard lock{mutex_};
-            Promise promise{scheduler_};
-            value_callbacks_.emplace([promise, result_callback = std::move(result_callback)](const Value &value)
-                                     { promise.set_result(result_callback(value)); });
-            error_callbacks_.emplace([promise](const Error &error)
-                                     { promise.set_result(Result{error}); });
-            schedule_callbacks();
+            Promise promise{scheduler};
+            promise.impl_->upstream_ = weak_from_this();
+            add({scheduler,
+                 to_dispatch(execution),
+                 false,
+                 [promise, result_callback = std::move(result_callback)](const Result &result)
+                 {
+                     if (const auto *value = result.value(); value)
+                     {
+                         promise.set_result(result_callback(*value));
+                     }
+                     else
+                     {
+                         promise.set_result(Result{result});
+                     }
+                 }});
             return promise;
         }
 
-        auto then(PromiseCallback &&promise_callback) noexcept -> Promise
+        auto then(PromiseCallback &&promise_callback,
+                  const Scheduler &scheduler,
+                  const Execution execution) noexcept -> Promise
         {
-            std::lock_guard lock{mutex_};
-            Promise promise{scheduler_};
-            value_callbacks_.emplace([promise, promise_callback = std::move(promise_callback)](const Value &value)
-                                     { promise.set_result_from_promise(promise_callback(value)); });
-            error_callbacks_.emplace([promise](const Error &error)
-                                     { promise.set_result(Result{error}); });
-            schedule_callbacks();
+            Promise promise{scheduler};
+            promise.impl_->upstream_ = weak_from_this();
+            add({scheduler,
+                 to_dispatch(execution),
+                 false,
+                 [promise, promise_callback = std::move(promise_callback)](const Result &result)
+                 {
+                     if (const auto *value = result.value(); value)
+                     {
+                         promise.set_result_from_promise(promise_callback(*value));
+                     }
+                     else
+                     {
+                         promise.set_result(Result{result});
+                     }
+                 }});
             return promise;
         }
 
-        auto fail(ErrorCallback &&error_callback) noexcept -> void
+        auto fail(ErrorCallback &&error_callback,
+                  const Scheduler &scheduler,
+                  const Execution execution) noexcept -> void
         {
-            std::lock_guard lock{mutex_};
-            error_callbacks_.push(std::move(error_callback));
-            schedule_callbacks();
+            push({scheduler,
+                  to_dispatch(execution),
+                  true,
+                  [error_callback = std::move(error_callback)](const Result &result)
+                  {
+                      if (const auto *error = result.error(); error)
+                      {
+                          error_callback(*error);
+                      }
+                  }});
         }
 
-        auto scheduler() const noexcept -> const Scheduler &
+        auto forward(const std::shared_ptr<impl_type> &impl) noexcept -> void
         {
-            return scheduler_;
+            add({scheduler_,
+                 dispatch_type::INLINE,
+                 false,
+                 [impl](const Result &result)
+                 {
+                     impl->set(Result{result});
+                 }});
+            // Watching the forwarded promise does not make it depend on
+            // this one, so it is pushed without being counted.
+            impl->push({impl->scheduler_,
+                        dispatch_type::SYNCHRONOUS,
+                        false,
+                        [weak_impl = weak_from_this(), forwarded = impl.get()](const Result &)
+                        {
+                            if (forwarded->is_cancelled())
+                            {
+                                if (const auto upstream = weak_impl.lock(); upstream)
+                                {
+                                    upstream->drop_dependent();
+                                }
+                            }
+                        }});
+        }
+
+        // Cancels the promise, which in turn fails the rest of the chain with
+        // Error::cancelled(). The promise it was chained from is cancelled
+        // too, but only once none of its dependents is left.
+        auto cancel() noexcept -> bool
+        {
+            return abandon(Error::cancelled());
+        }
+
+        // Fails the promise and gives up its place as a dependent of the
+        // promise it was chained from.
+        auto abandon(const Error &error) noexcept -> bool
+        {
+            if (!set(Result{error}))
+            {
+                return false;
+            }
+            if (const auto upstream = upstream_.lock(); upstream)
+            {
+                upstream->drop_dependent();
+            }
+            return true;
         }
 
-        auto result() noexcept -> Result
+        auto is_cancelled() const noexcept -> bool
         {
-            std::lock_guard lock{mutex_};
-            return result_;
+            return has_result() && cancelled_;
         }
 
-        auto has_result() noexcept -> bool
+        // Once this promise has a result, or is cancelled, the legs that are
+        // still pending are cancelled. They are only watched, so a leg that
+        // is dropped is not kept alive by the aggregate.
+        auto cancel_on_result(const std::vector<Promise> &promises) noexcept -> void
         {
-            std::lock_guard lock{mutex_};
-            return result_.type() != Result::Type::Undefined;
+            std::vector<std::weak_ptr<impl_type>> legs;
+            legs.reserve(promises.size());
+            for (const auto &promise : promises)
+            {
+                legs.push_back(promise.impl_);
+            }
+            push({scheduler_,
+                  dispatch_type::SYNCHRONOUS,
+                  false,
+                  [legs = std::move(legs)](const Result &)
+                  {
+                      for (const auto &leg : legs)
+                      {
+                          if (const auto impl = leg.lock(); impl)
+                          {
+                              impl->cancel();
+                          }
+                      }
+                  }});
         }
 
-        auto schedule_callbacks() noexcept -> void
+        // Runs the callback in the thread that sets the result, so it must
+        // be short and thread safe.
+        auto on_result(callback_type &&callback) noexcept -> void
         {
-            switch (result_.type())
+            push({scheduler_,
+                  dispatch_type::SYNCHRONOUS,
+                  false,
+                  std::move(callback)});
+        }
+
+        auto on_result(callback_type &&callback,
+                       const Execution execution) noexcept -> void
+        {
+            push({scheduler_,
+                  to_dispatch(execution),
+                  false,
+                  std::move(callback)});
+        }
+
+        // The follower gets the result unless the timer sets it first. Only
+        // the timer keeps the follower alive, and the followers that already
+        // have a result are dropped, so a source that never resolves does not
+        // accumulate them. The follower is a dependent, so once it expires or
+        // is cancelled, and no other dependent is left, the source is too.
+        auto follow(const std::shared_ptr<impl_type> &follower,
+                    const Timer &timer) noexcept -> void
+        {
+            follower->upstream_ = weak_from_this();
+            dependents_.fetch_add(1, std::memory_order_relaxed);
+            auto &observers = observe();
             {
-            case Result::Type::Value:
+                std::unique_lock lock{observers.mutex};
+                if (!has_result())
+                {
+                    auto &followers = observers.followers;
+                    followers.erase(std::remove_if(followers.begin(),
+                                                   followers.end(),
+                                                   [](const follower_type &each_follower)
+                                                   {
+                                                       const auto impl = each_follower.impl.lock();
+                                                       return !impl || impl->has_result();
+                                                   }),
+                                    followers.end());
+                    followers.push_back({follower, timer});
+                    return;
+                }
+            }
+            timer.cancel();
+            follower->set(Result{result_});
+        }
+
+        // The waiters share a single continuation, registered by the first
+        // of them, so waiting again after a timeout does not add another.
+        auto wait(const std::optional<Duration> &timeout) noexcept -> Result
+        {
+            if (!has_result())
             {
-                const Value value{*result_.value()};
-                while (!value_callbacks_.empty())
+                auto &observers = observe();
+                std::unique_lock lock{observers.mutex};
+                const auto is_ready = [this]
+                { return has_result(); };
+                if (timeout)
                 {
-                    scheduler_.schedule(
-                        [value_callback = std::move(value_callbacks_.front()), value]
-                        { value_callback(value); });
-                    value_callbacks_.pop();
+                    observers.condition.wait_for(lock, timeout.value(), is_ready);
                 }
-                if (!error_callbacks_.empty())
+                else
                 {
-                    ErrorCallbacks empty;
-                    error_callbacks_.swap(empty);
+                    observers.condition.wait(lock, is_ready);
                 }
-                break;
             }
-            case Result::Type::Error:
+            return result();
+        }
+
+        auto scheduler() const noexcept -> const Scheduler &
+        {
+            return scheduler_;
+        }
+
+        auto result() const noexcept -> Result
+        {
+            if (has_result())
+            {
+                return result_;
+            }
+            return Result{};
+        }
+
+        auto has_result() const noexcept -> bool
+        {
+            return state_.load(std::memory_order_acquire) == state_type::READY;
+        }
+
+    private:
+        struct follower_type
+        {
+            std::weak_ptr<impl_type> impl;
+            Timer timer;
+        };
+
+        struct observers_type
+        {
+            std::mutex mutex;
+            std::condition_variable condition;
+            std::vector<follower_type> followers;
+        };
+
+        // Created by the first follower or waiter and notified by a single
+        // continuation, so each of them is not a continuation of its own.
+        auto observe() noexcept -> observers_type &
+        {
+            auto *observers = observers_.load(std::memory_order_acquire);
+            if (observers != nullptr)
+            {
+                return *observers;
+            }
+            auto *created = new observers_type{};
+            if (!observers_.compare_exchange_strong(observers,
+                                                    created,
+                                                    std::memory_order_acq_rel,
+                                                    std::memory_order_acquire))
             {
-                const Error error{*result_.error()};
-                while (!error_callbacks_.empty())
+                delete created;
+                return *observers;
+            }
+            // The continuation runs while the result is being set, when the
+            // promise is still alive.
+            on_result(
+                [this](const Result &result)
                 {
-                    scheduler_.schedule(
-                        [error_callback = std::move(error_callbacks_.front()), error]
-                        { error_callback(error); });
-                    error_callbacks_.pop();
+                    notify(result);
+                });
+            return *created;
+        }
+
+        auto notify(const Result &result) noexcept -> void
+        {
+            auto &observers = *observers_.load(std::memory_order_acquire);
+            std::vector<follower_type> followers;
+            {
+                std::unique_lock lock{observers.mutex};
+                followers.swap(observers.followers);
+                observers.condition.notify_all();
+            }
+            for (const auto &follower : followers)
+            {
+                if (const auto impl = follower.impl.lock(); impl)
+                {
+                    follower.timer.cancel();
+                    impl->set(Result{result});
                 }
-                if (!value_callbacks_.empty())
+            }
+        }
+
+        // Marks the list of callbacks as consumed, once the result is ready.
+        auto closed() noexcept -> node_type *
+        {
+            return reinterpret_cast<node_type *>(&head_);
+        }
+
+        // The first continuation is stored in the promise itself, since
+        // most promises have a single one.
+        auto acquire(continuation_type &&continuation) noexcept -> node_type *
+        {
+            if (!inline_node_used_.test_and_set(std::memory_order_relaxed))
+            {
+                return new (inline_node_) node_type{std::move(continuation), nullptr};
+            }
+            return new (Pool::allocate(sizeof(node_type))) node_type{std::move(continuation), nullptr};
+        }
+
+        auto release(node_type *node) noexcept -> void
+        {
+            if (node == reinterpret_cast<node_type *>(inline_node_))
+            {
+                node->~node_type();
+            }
+            else
+            {
+                node->~node_type();
+                Pool::deallocate(node, sizeof(node_type));
+            }
+        }
+
+        // Only the chained promises and the followers are dependents of the
+        // promise, and they give their place up once cancelled or expired.
+        // Error handlers, waiters and the legs of the combinators observe it
+        // without keeping it from being cancelled, they are pushed directly.
+        auto add(continuation_type &&continuation) noexcept -> void
+        {
+            dependents_.fetch_add(1, std::memory_order_relaxed);
+            push(std::move(continuation));
+        }
+
+        auto drop_dependent() noexcept -> void
+        {
+            if (dependents_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                cancel();
+            }
+        }
+
+        auto push(continuation_type &&continuation) noexcept -> void
+        {
+            auto *node = acquire(std::move(continuation));
+            auto *head = head_.load(std::memory_order_acquire);
+            while (head != closed())
+            {
+                node->next = head;
+                if (head_.compare_exchange_weak(head,
+                                                node,
+                                                std::memory_order_release,
+                                                std::memory_order_acquire))
                 {
-                    ValueCallbacks empty;
-                    value_callbacks_.swap(empty);
+                    return;
                 }
-                break;
             }
-            case Result::Type::Undefined:
-                break;
+            dispatch(std::move(node->continuation));
+            release(node);
+        }
+
+        // Only called once the result is ready, which is never modified.
+        auto dispatch(continuation_type &&continuation) noexcept -> void
+        {
+            if (continuation.only_error && result_.type() != Result::Type::Error)
+            {
+                return;
+            }
+            if (continuation.dispatch == dispatch_type::SYNCHRONOUS ||
+                (continuation.dispatch == dispatch_type::INLINE &&
+                 continuation.scheduler.is_worker_thread()))
+            {
+                continuation.callback(result_);
+            }
+            else
+            {
+                continuation.scheduler.schedule(
+                    [callback = std::move(continuation.callback), result = result_]
+                    { callback(result); });
             }
         }
 
-    private:
         Scheduler scheduler_;
+        std::weak_ptr<impl_type> upstream_;
         Result result_;
-        std::mutex mutex_;
-        ValueCallbacks value_callbacks_;
-        ErrorCallbacks error_callbacks_;
+        std::atomic<state_type> state_;
+        std::atomic<node_type *> head_;
+        std::atomic<observers_type *> observers_;
+        std::atomic<std::size_t> dependents_;
+        bool cancelled_ = false;
+        std::atomic_flag inline_node_used_ = ATOMIC_FLAG_INIT;
+        alignas(node_type) std::byte inline_node_[sizeof(node_type)];
     };
 
     Promise::Promise(const Scheduler &scheduler) noexcept
-        : impl_(std::make_shared<impl_type>(scheduler))
+        : impl_(make_pooled<impl_type>(scheduler))
     {
     }
 
@@ -164,6 +549,26 @@ namespace traeger
         return impl_->has_result();
     }
 
+    auto Promise::cancel() const noexcept -> bool
+    {
+        return impl_->cancel();
+    }
+
+    auto Promise::is_cancelled() const noexcept -> bool
+    {
+        return impl_->is_cancelled();
+    }
+
+    auto Promise::wait() const noexcept -> Result
+    {
+        return impl_->wait(std::nullopt);
+    }
+
+    auto Promise::wait_for(const Duration &timeout) const noexcept -> Result
+    {
+        return impl_->wait(timeout);
+    }
+
     auto Promise::set_result(const Result &result) const noexcept -> bool
     {
         return impl_->set(Result{result});
@@ -176,31 +581,191 @@ namespace traeger
 
     auto Promise::set_result_from_promise(const Promise &promise) const noexcept -> void
     {
-        promise.then(
-            [impl = impl_](const Value &value) -> Result
-            {
-                impl->set(Result{value});
-                return Result{};
-            });
-        promise.fail(
-            [impl = impl_](const Error &error) -> void
-            {
-                impl->set(Result{error});
-            });
+        promise.impl_->forward(impl_);
     }
 
     auto Promise::then(ResultCallback &&result_callback) const noexcept -> Promise
     {
-        return impl_->then(std::move(result_callback));
+        return impl_->then(std::move(result_callback), scheduler(), Execution::Schedule);
+    }
+
+    auto Promise::then(ResultCallback &&result_callback,
+                       const Execution execution) const noexcept -> Promise
+    {
+        return impl_->then(std::move(result_callback), scheduler(), execution);
+    }
+
+    auto Promise::then(ResultCallback &&result_callback,
+                       const Scheduler &scheduler) const noexcept -> Promise
+    {
+        return impl_->then(std::move(result_callback), scheduler, Execution::Schedule);
     }
 
     auto Promise::then(PromiseCallback &&promise_callback) const noexcept -> Promise
     {
-        return impl_->then(std::move(promise_callback));
+        return impl_->then(std::move(promise_callback), scheduler(), Execution::Schedule);
+    }
+
+    auto Promise::then(PromiseCallback &&promise_callback,
+                       const Execution execution) const noexcept -> Promise
+    {
+        return impl_->then(std::move(promise_callback), scheduler(), execution);
+    }
+
+    auto Promise::then(PromiseCallback &&promise_callback,
+                       const Scheduler &scheduler) const noexcept -> Promise
+    {
+        return impl_->then(std::move(promise_callback), scheduler, Execution::Schedule);
     }
 
     auto Promise::fail(ErrorCallback &&error_callback) const noexcept -> void
     {
-        return impl_->fail(std::move(error_callback));
+        impl_->fail(std::move(error_callback), scheduler(), Execution::Schedule);
+    }
+
+    auto Promise::fail(ErrorCallback &&error_callback,
+                       const Execution execution) const noexcept -> void
+    {
+        impl_->fail(std::move(error_callback), scheduler(), execution);
+    }
+
+    auto Promise::fail(ErrorCallback &&error_callback,
+                       const Scheduler &scheduler) const noexcept -> void
+    {
+        impl_->fail(std::move(error_callback), scheduler, Execution::Schedule);
+    }
+
+    auto Promise::on_result(ResultHandler &&result_handler,
+                            const Execution execution) const noexcept -> void
+    {
+        impl_->on_result(std::move(result_handler), execution);
+    }
+
+    auto Promise::with_timeout(const Duration &timeout) const noexcept -> Promise
+    {
+        Promise promise{scheduler()};
+        // The timer keeps the promise alive until it fires or is cancelled.
+        const auto timer = scheduler().schedule_timer(
+            timeout,
+            [impl = promise.impl_]
+            {
+                impl->abandon(Error::timeout());
+            });
+        impl_->follow(promise.impl_, timer);
+        return promise;
+    }
+
+    namespace
+    {
+        struct aggregate_type
+        {
+            aggregate_type(Promise promise,
+                           const std::size_t remaining,
+                           const std::size_t values_count) noexcept
+                : promise(std::move(promise)),
+                  remaining(remaining),
+                  values(values_count)
+            {
+            }
+
+            const Promise promise;
+            std::atomic<std::size_t> remaining;
+            std::vector<Value> values;
+        };
+
+        auto no_promises_result() noexcept -> Result
+        {
+            return Result{Error{"no promises were given"}};
+        }
+    }
+
+    auto Promise::when_all(const Scheduler &scheduler,
+                           const std::vector<Promise> &promises) noexcept -> Promise
+    {
+        Promise promise{scheduler};
+        if (promises.empty())
+        {
+            promise.set_result(Result{Value{List{}}});
+            return promise;
+        }
+
+        const auto aggregate = std::make_shared<aggregate_type>(promise, promises.size(), promises.size());
+        for (std::size_t index = 0; index < promises.size(); ++index)
+        {
+            promises[index].impl_->on_result(
+                [aggregate, index](const Result &result)
+                {
+                    const auto *value = result.value();
+                    if (!value)
+                    {
+                        aggregate->promise.set_result(Result{result});
+                        return;
+                    }
+                    aggregate->values[index] = *value;
+                    if (aggregate->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                    {
+                        List list;
+                        for (auto &&each_value : aggregate->values)
+                        {
+                            list.append(std::move(each_value));
+                        }
+                        aggregate->promise.set_result(Result{Value{std::move(list)}});
+                    }
+                });
+        }
+        promise.impl_->cancel_on_result(promises);
+        return promise;
+    }
+
+    auto Promise::when_any(const Scheduler &scheduler,
+                           const std::vector<Promise> &promises) noexcept -> Promise
+    {
+        Promise promise{scheduler};
+        if (promises.empty())
+        {
+            promise.set_result(no_promises_result());
+            return promise;
+        }
+
+        const auto aggregate = std::make_shared<aggregate_type>(promise, promises.size(), 0);
+        for (const auto &each_promise : promises)
+        {
+            each_promise.impl_->on_result(
+                [aggregate](const Result &result)
+                {
+                    if (result.value())
+                    {
+                        aggregate->promise.set_result(Result{result});
+                    }
+                    else if (aggregate->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                    {
+                        aggregate->promise.set_result(Result{result});
+                    }
+                });
+        }
+        promise.impl_->cancel_on_result(promises);
+        return promise;
+    }
+
+    auto Promise::race(const Scheduler &scheduler,
+                       const std::vector<Promise> &promises) noexcept -> Promise
+    {
+        Promise promise{scheduler};
+        if (promises.empty())
+        {
+            promise.set_result(no_promises_result());
+            return promise;
+        }
+
+        for (const auto &each_promise : promises)
+        {
+            each_promise.impl_->on_result(
+                [impl = promise.impl_](const Result &result)
+                {
+                    impl->set(Result{result});
+                });
+        }
+        promise.impl_->cancel_on_result(promises);
+        return promise;
     }
 }
@@ -5,6 +5,7 @@
 #include <functional>
 #include <memory>
 #include <queue>
+#include <vector>
 
 #include <traeger/actor/Result.hpp>
 #include <traeger/actor/Scheduler.hpp>
@@ -23,10 +24,18 @@ namespace traeger
 
         using ErrorCallback = std::function<void(const Error &)>;
 
+        using ResultHandler = std::function<void(const Result &)>;
+
         using ValueCallbacks = std::queue<ValueCallback>;
 
         using ErrorCallbacks = std::queue<ErrorCallback>;
 
+        enum class Execution : int
+        {
+            Schedule = 0,
+            Inline = 1,
+        };
+
         Promise(const Promise &other) noexcept;
 
         Promise(Promise &&other) noexcept;
@@ -43,6 +52,17 @@ namespace traeger
 
         auto has_result() const noexcept -> bool;
 
+        auto cancel() const noexcept -> bool;
+
+        auto is_cancelled() const noexcept -> bool;
+
+        // Blocks the calling thread until the result is ready, so it must
+        // not be called from the scheduler that sets it.
+        auto wait() const noexcept -> Result;
+
+        // Like wait(), but returns an undefined result if the timeout expires.
+        auto wait_for(const Duration &timeout) const noexcept -> Result;
+
         auto set_result(const Result &result) const noexcept -> bool;
 
         auto set_result(Result &&result) const noexcept -> bool;
@@ -51,10 +71,42 @@ namespace traeger
 
         auto then(ResultCallback &&result_callback) const noexcept -> Promise;
 
+        auto then(ResultCallback &&result_callback,
+                  Execution execution) const noexcept -> Promise;
+
+        auto then(ResultCallback &&result_callback,
+                  const Scheduler &scheduler) const noexcept -> Promise;
+
         auto then(PromiseCallback &&promise_callback) const noexcept -> Promise;
 
+        auto then(PromiseCallback &&promise_callback,
+                  Execution execution) const noexcept -> Promise;
+
+        auto then(PromiseCallback &&promise_callback,
+                  const Scheduler &scheduler) const noexcept -> Promise;
+
         auto fail(ErrorCallback &&error_callback) const noexcept -> void;
 
+        auto fail(ErrorCallback &&error_callback,
+                  Execution execution) const noexcept -> void;
+
+        auto fail(ErrorCallback &&error_callback,
+                  const Scheduler &scheduler) const noexcept -> void;
+
+        auto on_result(ResultHandler &&result_handler,
+                       Execution execution) const noexcept -> void;
+
+        auto with_timeout(const Duration &timeout) const noexcept -> Promise;
+
+        static auto when_all(const Scheduler &scheduler,
+                             const std::vector<Promise> &promises) noexcept -> Promise;
+
+        static auto when_any(const Scheduler &scheduler,
+                             const std::vector<Promise> &promises) noexcept -> Promise;
+
+        static auto race(const Scheduler &scheduler,
+                         const std::vector<Promise> &promises) noexcept -> Promise;
+
     private:
         struct impl_type;
         std::shared_ptr<impl_type> impl_;
@@ -8,6 +8,28 @@
 
 namespace traeger
 {
+    auto Error::timeout() noexcept -> const Error &
+    {
+        static const Error error{{"timeout"}, Code::Timeout};
+        return error;
+    }
+
+    auto Error::is_timeout() const noexcept -> bool
+    {
+        return code == Code::Timeout;
+    }
+
+    auto Error::cancelled() noexcept -> const Error &
+    {
+        static const Error error{{"cancelled"}, Code::Cancelled};
+        return error;
+    }
+
+    auto Error::is_cancelled() const noexcept -> bool
+    {
+        return code == Code::Cancelled;
+    }
+
     Result::Result() noexcept
         : type_(Type::Undefined)
     {
@@ -17,6 +39,7 @@ namespace traeger
 
     Result::Result(Result &&other) noexcept
         : value_(std::move(other.value_)),
+          error_(std::move(other.error_)),
           type_(other.type_)
     {
         other.value_ = nullptr;
@@ -37,13 +60,13 @@ namespace traeger
 
     Result::Result(const Error &error) noexcept
     {
-        value_ = error;
+        error_ = error;
         type_ = Type::Error;
     }
 
     Result::Result(Error &&error) noexcept
     {
-        value_ = std::move(error);
+        error_ = std::move(error);
         type_ = Type::Error;
     }
 
@@ -52,6 +75,7 @@ namespace traeger
     auto Result::operator=(Result &&other) noexcept -> Result &
     {
         value_ = std::move(other.value_);
+        error_ = std::move(other.error_);
         type_ = other.type_;
         other.value_ = nullptr;
         other.type_ = Type::Undefined;
@@ -60,12 +84,15 @@ namespace traeger
 
     auto Result::operator==(const Result &other) const noexcept -> bool
     {
-        return type_ == other.type_ && value_ == other.value_;
+        return type_ == other.type_ &&
+               value_ == other.value_ &&
+               error_ == other.error_ &&
+               error_.code == other.error_.code;
     }
 
     auto Result::operator!=(const Result &other) const noexcept -> bool
     {
-        return type_ != other.type_ || value_ != other.value_;
+        return !(*this == other);
     }
 
     auto Result::type() const noexcept -> Type
@@ -82,11 +109,11 @@ namespace traeger
         return nullptr;
     }
 
-    auto Result::error() const & noexcept -> const String *
+    auto Result::error() const & noexcept -> const Error *
     {
         if (type_ == Type::Error)
         {
-            return value_.get_string();
+            return &error_;
         }
         return nullptr;
     }
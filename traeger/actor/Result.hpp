@@ -10,6 +10,24 @@ namespace traeger
 {
     struct Error : String
     {
+        // Timeouts and cancellations are told apart by their code, so an
+        // error with the same text coming from elsewhere is not taken for one.
+        enum class Code : int
+        {
+            Other = 0,
+            Timeout = 1,
+            Cancelled = 2,
+        };
+
+        Code code{Code::Other};
+
+        static auto timeout() noexcept -> const Error &;
+
+        auto is_timeout() const noexcept -> bool;
+
+        static auto cancelled() noexcept -> const Error &;
+
+        auto is_cancelled() const noexcept -> bool;
     };
 
     struct Result
@@ -47,7 +65,7 @@ namespace traeger
 
         auto value() const & noexcept -> const Value *;
 
-        auto error() const & noexcept -> const String *;
+        auto error() const & noexcept -> const Error *;
 
         auto type_name() const noexcept -> const String &;
 
@@ -55,6 +73,7 @@ namespace traeger
 
     private:
         Value value_;
+        Error error_;
         Type type_;
     };
 
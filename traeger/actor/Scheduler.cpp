@@ -11,6 +11,7 @@
 #include <mutex>
 #include <cmath>
 
+#include "traeger/actor/Pool.hpp"
 #include "traeger/actor/Scheduler.hpp"
 
 namespace traeger
@@ -21,6 +22,48 @@ namespace traeger
         return std::chrono::microseconds(microseconds);
     }
 
+    struct Timer::impl_type
+    {
+        explicit impl_type(Work &&work) noexcept
+            : active_(true),
+              work_(std::move(work))
+        {
+        }
+
+        auto fire() noexcept -> void
+        {
+            if (active_.exchange(false, std::memory_order_acq_rel))
+            {
+                auto work = std::move(work_);
+                work();
+            }
+        }
+
+        auto cancel() noexcept -> bool
+        {
+            if (active_.exchange(false, std::memory_order_acq_rel))
+            {
+                work_ = nullptr;
+                return true;
+            }
+            return false;
+        }
+
+    private:
+        std::atomic<bool> active_;
+        Work work_;
+    };
+
+    Timer::Timer(const std::shared_ptr<impl_type> &impl) noexcept
+        : impl_(impl)
+    {
+    }
+
+    auto Timer::cancel() const noexcept -> bool
+    {
+        return impl_->cancel();
+    }
+
     struct Scheduler::impl_type
     {
         struct ScheduledWork
@@ -95,8 +138,14 @@ namespace traeger
                             { return threads_count_ == 0; });
         }
 
+        auto is_worker_thread() const noexcept -> bool
+        {
+            return current_ == this;
+        }
+
         auto worker() noexcept -> void
         {
+            current_ = this;
             while (true)
             {
                 Work work;
@@ -162,6 +211,8 @@ namespace traeger
         }
 
     private:
+        inline static thread_local const impl_type *current_ = nullptr;
+
         bool active_;
         unsigned int threads_count_;
         std::atomic<unsigned int> active_threads_count_;
@@ -189,8 +240,22 @@ namespace traeger
         impl_->schedule(delay, std::move(work));
     }
 
+    auto Scheduler::schedule_timer(const Duration &delay,
+                                   Work &&work) const noexcept -> Timer
+    {
+        const auto timer_impl = make_pooled<Timer::impl_type>(std::move(work));
+        impl_->schedule(delay, [timer_impl]
+                        { timer_impl->fire(); });
+        return Timer{timer_impl};
+    }
+
     auto Scheduler::count() const noexcept -> std::size_t
     {
         return impl_.use_count() + impl_->count() - 1;
     }
+
+    auto Scheduler::is_worker_thread() const noexcept -> bool
+    {
+        return impl_->is_worker_thread();
+    }
 }
@@ -23,6 +23,20 @@ namespace traeger
         unsigned int count;
     };
 
+    struct Timer
+    {
+        auto cancel() const noexcept -> bool;
+
+    private:
+        friend struct Scheduler;
+
+        struct impl_type;
+
+        explicit Timer(const std::shared_ptr<impl_type> &impl) noexcept;
+
+        std::shared_ptr<impl_type> impl_;
+    };
+
     struct Scheduler
     {
         Scheduler() = delete;
@@ -34,8 +48,13 @@ namespace traeger
         auto schedule_delayed(const Duration &delay,
                               Work &&work) const noexcept -> void;
 
+        auto schedule_timer(const Duration &delay,
+                            Work &&work) const noexcept -> Timer;
+
         auto count() const noexcept -> std::size_t;
 
+        auto is_worker_thread() const noexcept -> bool;
+
     private:
         struct impl_type;
         std::shared_ptr<impl_type> impl_;
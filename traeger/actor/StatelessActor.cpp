@@ -16,7 +16,7 @@
 
 namespace traeger
 {
-    struct StatelessActor::impl_type
+    struct StatelessActor::Executor::impl_type
     {
         enum class concurrency_type : int
         {
@@ -62,50 +62,54 @@ namespace traeger
             Work work;
         };
 
-        struct queue_impl_type
+        auto push(task_type &&task) noexcept -> void
         {
-            auto push(task_type &&task) noexcept -> void
-            {
-                std::lock_guard tasks_lock{tasks_mutex_};
-                tasks_.emplace(std::move(task));
-            }
+            std::lock_guard tasks_lock{tasks_mutex_};
+            tasks_.emplace(std::move(task));
+        }
 
-            auto schedule_next(const Scheduler &scheduler,
-                               const std::shared_ptr<queue_impl_type> &impl) noexcept -> void
+        auto schedule_next(const Scheduler &scheduler,
+                           const std::shared_ptr<impl_type> &impl) noexcept -> void
+        {
+            std::unique_lock tasks_lock{tasks_mutex_};
+            if (!tasks_.empty())
             {
-                std::unique_lock tasks_lock{tasks_mutex_};
-                if (!tasks_.empty())
-                {
-                    scheduler.schedule(
-                        [scheduler, impl]
-                        {
-                            impl->try_to_execute_next();
-                            impl->schedule_next(scheduler, impl);
-                        });
-                }
+                scheduler.schedule(
+                    [scheduler, impl]
+                    {
+                        impl->try_to_execute_next();
+                        impl->schedule_next(scheduler, impl);
+                    });
             }
+        }
 
-        private:
-            auto try_to_execute_next() noexcept -> void
+    private:
+        auto try_to_execute_next() noexcept -> void
+        {
+            std::unique_lock tasks_lock{tasks_mutex_};
+            if (!tasks_.empty())
             {
-                std::unique_lock tasks_lock{tasks_mutex_};
-                if (!tasks_.empty())
+                auto &&next = std::move(tasks_.front());
+                if (const auto lock = lock_type{next.concurrency, execution_mutex_}; lock)
                 {
-                    auto &&next = std::move(tasks_.front());
-                    if (const auto lock = lock_type{next.concurrency, execution_mutex_}; lock)
-                    {
-                        const auto work = std::move(next).work;
-                        tasks_.pop();
-                        tasks_lock.unlock();
-                        work();
-                    }
+                    const auto work = std::move(next).work;
+                    tasks_.pop();
+                    tasks_lock.unlock();
+                    work();
                 }
             }
+        }
 
-            std::shared_mutex execution_mutex_;
-            std::mutex tasks_mutex_;
-            std::queue<task_type> tasks_;
-        };
+        std::shared_mutex execution_mutex_;
+        std::mutex tasks_mutex_;
+        std::queue<task_type> tasks_;
+    };
+
+    struct StatelessActor::impl_type
+    {
+        using concurrency_type = Executor::impl_type::concurrency_type;
+
+        using queue_impl_type = Executor::impl_type;
 
         using map_type = immer::map<String, std::pair<concurrency_type, Function>>;
 
@@ -134,7 +138,11 @@ namespace traeger
                         {concurrency,
                          [promise, function = function, arguments]
                          {
-                             promise.set_result(function(arguments));
+                             // Skip the tasks cancelled while queued.
+                             if (!promise.has_result())
+                             {
+                                 promise.set_result(function(arguments));
+                             }
                          }});
                     queue_->schedule_next(scheduler, queue_);
                 }
@@ -167,6 +175,11 @@ namespace traeger
             return std::make_unique<mailbox_impl_type>(queue_, functions_);
         }
 
+        auto queue() const noexcept -> const std::shared_ptr<queue_impl_type> &
+        {
+            return queue_;
+        }
+
     private:
         std::shared_ptr<queue_impl_type> queue_;
         map_type::transient_type functions_;
@@ -205,4 +218,28 @@ namespace traeger
     {
         return impl_->mailbox();
     }
+
+    auto StatelessActor::executor() const noexcept -> Executor
+    {
+        return Executor{impl_->queue()};
+    }
+
+    StatelessActor::Executor::Executor(const std::shared_ptr<impl_type> &impl) noexcept
+        : impl_(impl)
+    {
+    }
+
+    auto StatelessActor::Executor::schedule_reader(const Scheduler &scheduler,
+                                                   Work &&work) const noexcept -> void
+    {
+        impl_->push({impl_type::concurrency_type::SHARED, std::move(work)});
+        impl_->schedule_next(scheduler, impl_);
+    }
+
+    auto StatelessActor::Executor::schedule_writer(const Scheduler &scheduler,
+                                                   Work &&work) const noexcept -> void
+    {
+        impl_->push({impl_type::concurrency_type::EXCLUSIVE, std::move(work)});
+        impl_->schedule_next(scheduler, impl_);
+    }
 }
@@ -14,6 +14,24 @@ namespace traeger
 
     struct StatelessActor
     {
+        struct Executor
+        {
+            auto schedule_reader(const Scheduler &scheduler,
+                                 Work &&work) const noexcept -> void;
+
+            auto schedule_writer(const Scheduler &scheduler,
+                                 Work &&work) const noexcept -> void;
+
+        private:
+            friend StatelessActor;
+
+            struct impl_type;
+
+            explicit Executor(const std::shared_ptr<impl_type> &impl) noexcept;
+
+            std::shared_ptr<impl_type> impl_;
+        };
+
         ~StatelessActor() noexcept;
 
         StatelessActor() noexcept;
@@ -32,6 +50,8 @@ namespace traeger
 
         auto mailbox_interface() const noexcept -> std::unique_ptr<Mailbox::Interface>;
 
+        auto executor() const noexcept -> Executor;
+
     private:
         struct impl_type;
         std::unique_ptr<impl_type> impl_;
@@ -89,6 +89,10 @@ extern "C"
                                       traeger_value_t **value,
                                       traeger_string_t **error);
 
+    bool traeger_result_is_timeout(const traeger_result_t *self);
+
+    bool traeger_result_is_cancelled(const traeger_result_t *self);
+
     // Function
 
     typedef void (*traeger_function_callback_t)(const traeger_list_t *arguments,
@@ -145,6 +149,17 @@ extern "C"
     void traeger_promise_get_result(const traeger_promise_t *self,
                                     traeger_result_t **result);
 
+    bool traeger_promise_cancel(const traeger_promise_t *self);
+
+    bool traeger_promise_is_cancelled(const traeger_promise_t *self);
+
+    void traeger_promise_wait(const traeger_promise_t *self,
+                              traeger_result_t **result);
+
+    bool traeger_promise_wait_for(const traeger_promise_t *self,
+                                  traeger_float_t timeout,
+                                  traeger_result_t **result);
+
     bool traeger_promise_set_result(const traeger_promise_t *self,
                                     const traeger_result_t *result);
 
@@ -177,6 +192,21 @@ extern "C"
                               traeger_closure_t closure,
                               traeger_closure_free_t closure_free);
 
+    traeger_promise_t *traeger_promise_with_timeout(const traeger_promise_t *self,
+                                                    traeger_float_t timeout);
+
+    traeger_promise_t *traeger_promise_when_all(const traeger_scheduler_t *scheduler,
+                                                const traeger_promise_t *const *promises,
+                                                size_t promises_size);
+
+    traeger_promise_t *traeger_promise_when_any(const traeger_scheduler_t *scheduler,
+                                                const traeger_promise_t *const *promises,
+                                                size_t promises_size);
+
+    traeger_promise_t *traeger_promise_race(const traeger_scheduler_t *scheduler,
+                                            const traeger_promise_t *const *promises,
+                                            size_t promises_size);
+
     // Mailbox
 
     traeger_mailbox_t *traeger_mailbox_copy(const traeger_mailbox_t *self);
@@ -1,5 +1,8 @@
 // SPDX-License-Identifier: BSL-1.0
 
+#include <optional>
+#include <vector>
+
 #include "traeger/actor/actor.h"
 #include "traeger/value/traeger_value.hpp"
 #include "traeger/actor/traeger_actor.hpp"
@@ -74,6 +77,22 @@ namespace
             error_callback(&error, closure.get());
         };
     }
+
+    auto make_promises(const traeger_promise_t *const *promises,
+                       const size_t promises_size) noexcept -> std::optional<std::vector<Promise>>
+    {
+        std::vector<Promise> vector;
+        vector.reserve(promises_size);
+        for (size_t index = 0; index < promises_size; ++index)
+        {
+            if (promises[index] == nullptr)
+            {
+                return std::nullopt;
+            }
+            vector.push_back(cast(promises[index]));
+        }
+        return vector;
+    }
 }
 
 extern "C"
@@ -231,6 +250,30 @@ extern "C"
         return TRAEGER_RESULT_TYPE_UNDEFINED;
     }
 
+    bool traeger_result_is_timeout(const traeger_result_t *self)
+    {
+        if (self != nullptr)
+        {
+            if (const auto *error = cast(self).error())
+            {
+                return error->is_timeout();
+            }
+        }
+        return false;
+    }
+
+    bool traeger_result_is_cancelled(const traeger_result_t *self)
+    {
+        if (self != nullptr)
+        {
+            if (const auto *error = cast(self).error())
+            {
+                return error->is_cancelled();
+            }
+        }
+        return false;
+    }
+
     // Function
 
     traeger_function_t *traeger_function_new(const traeger_function_callback_t function_callback,
@@ -391,6 +434,47 @@ extern "C"
         }
     }
 
+    bool traeger_promise_cancel(const traeger_promise_t *self)
+    {
+        if (self != nullptr)
+        {
+            return cast(self).cancel();
+        }
+        return false;
+    }
+
+    bool traeger_promise_is_cancelled(const traeger_promise_t *self)
+    {
+        if (self != nullptr)
+        {
+            return cast(self).is_cancelled();
+        }
+        return false;
+    }
+
+    void traeger_promise_wait(const traeger_promise_t *self,
+                              traeger_result_t **result)
+    {
+        if (self != nullptr &&
+            result != nullptr)
+        {
+            *result = new traeger_result_t{cast(self).wait()};
+        }
+    }
+
+    bool traeger_promise_wait_for(const traeger_promise_t *self,
+                                  const traeger_float_t timeout,
+                                  traeger_result_t **result)
+    {
+        if (self != nullptr &&
+            result != nullptr)
+        {
+            *result = new traeger_result_t{cast(self).wait_for(to_microseconds(timeout))};
+            return (*result)->type() != Result::Type::Undefined;
+        }
+        return false;
+    }
+
     bool traeger_promise_set_result(const traeger_promise_t *self,
                                     const traeger_result_t *result)
     {
@@ -463,6 +547,61 @@ extern "C"
         }
     }
 
+    traeger_promise_t *traeger_promise_with_timeout(const traeger_promise_t *self,
+                                                    const traeger_float_t timeout)
+    {
+        if (self != nullptr)
+        {
+            return new traeger_promise_t{cast(self).with_timeout(to_microseconds(timeout))};
+        }
+        return nullptr;
+    }
+
+    traeger_promise_t *traeger_promise_when_all(const traeger_scheduler_t *scheduler,
+                                                const traeger_promise_t *const *promises,
+                                                const size_t promises_size)
+    {
+        if (scheduler != nullptr &&
+            (promises != nullptr || promises_size == 0))
+        {
+            if (auto vector = make_promises(promises, promises_size); vector)
+            {
+                return new traeger_promise_t{Promise::when_all(cast(scheduler), vector.value())};
+            }
+        }
+        return nullptr;
+    }
+
+    traeger_promise_t *traeger_promise_when_any(const traeger_scheduler_t *scheduler,
+                                                const traeger_promise_t *const *promises,
+                                                const size_t promises_size)
+    {
+        if (scheduler != nullptr &&
+            (promises != nullptr || promises_size == 0))
+        {
+            if (auto vector = make_promises(promises, promises_size); vector)
+            {
+                return new traeger_promise_t{Promise::when_any(cast(scheduler), vector.value())};
+            }
+        }
+        return nullptr;
+    }
+
+    traeger_promise_t *traeger_promise_race(const traeger_scheduler_t *scheduler,
+                                            const traeger_promise_t *const *promises,
+                                            const size_t promises_size)
+    {
+        if (scheduler != nullptr &&
+            (promises != nullptr || promises_size == 0))
+        {
+            if (auto vector = make_promises(promises, promises_size); vector)
+            {
+                return new traeger_promise_t{Promise::race(cast(scheduler), vector.value())};
+            }
+        }
+        return nullptr;
+    }
+
     // Mailbox
 
     traeger_mailbox_t *traeger_mailbox_copy(const traeger_mailbox_t *self)
@@ -1,5 +1,7 @@
 // SPDX-License-Identifier: BSL-1.0
 
+#include <cstddef>
+#include <utility>
 #include <variant>
 
 #include <nlohmann/json.hpp>
@@ -28,28 +30,42 @@ namespace
     auto json_from(const Value::impl_type::map_type &values) -> nlohmann::json;
     auto json_from(const Value &value) -> nlohmann::json;
 
-    auto list_from_json(const nlohmann::json &object) -> List
+    // JSON has no bytes type, blobs are encoded as base64 strings.
+    auto base64_from(const Blob &blob) -> String
     {
-        List list;
-        const auto end = object.end();
-        const auto begin = object.begin();
-        for (auto it = begin; it != end; ++it)
+        static constexpr char alphabet[] =
+            "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+        const auto *bytes = reinterpret_cast<const unsigned char *>(blob.data());
+        const auto size = blob.size();
+        String result;
+        result.reserve((size + 2) / 3 * 4);
+        for (std::size_t i = 0; i < size; i += 3)
         {
-            list.append(value_from_json(it.value()));
+            const auto remaining = size - i;
+            const auto chunk = (bytes[i] << 16) |
+                               (remaining > 1 ? bytes[i + 1] << 8 : 0) |
+                               (remaining > 2 ? bytes[i + 2] : 0);
+            result += alphabet[(chunk >> 18) & 0x3F];
+            result += alphabet[(chunk >> 12) & 0x3F];
+            result += remaining > 1 ? alphabet[(chunk >> 6) & 0x3F] : '=';
+            result += remaining > 2 ? alphabet[chunk & 0x3F] : '=';
         }
-        return list;
+        return result;
+    }
+
+    auto list_from_json(const nlohmann::json &object) -> List
+    {
+        return List::from_range(object.begin(), object.end(),
+                                [](const nlohmann::json &item)
+                                { return value_from_json(item); });
     }
 
     auto map_from_json(const nlohmann::json &object) -> Map
     {
-        Map map;
-        const auto begin = object.begin();
-        const auto end = object.end();
-        for (auto it = begin; it != end; ++it)
-        {
-            map.set(it.key(), value_from_json(it.value()));
-        }
-        return map;
+        const auto items = object.items();
+        return Map::from_pairs(items.begin(), items.end(),
+                               [](const auto &item)
+                               { return std::pair{Atom{item.key()}, value_from_json(item.value())}; });
     }
 
     auto value_from_json(const nlohmann::json &object) -> Value
@@ -91,7 +107,7 @@ namespace
         nlohmann::json object;
         for (const auto &[key, value] : values)
         {
-            object.emplace(key, json_from(value));
+            object.emplace(key.str(), json_from(value));
         }
         return object;
     }
@@ -102,12 +118,18 @@ namespace
             overload{
                 [](const auto scalar)
                 { return nlohmann::json(scalar); },
-                [](const Value::impl_type::string_type &boxed)
-                { return nlohmann::json(boxed.get()); },
+                [](const Value::impl_type::string_type &string)
+                { return nlohmann::json(string.view()); },
                 [](const Value::impl_type::list_type &values)
                 { return json_from(values); },
                 [](const Value::impl_type::map_type &values)
                 { return json_from(values); },
+                [](const Blob &blob)
+                { return nlohmann::json(base64_from(blob)); },
+                [](const Value::impl_type::float_array_type &array)
+                { return nlohmann::json(nlohmann::json::array_t(array.begin(), array.end())); },
+                [](const Value::impl_type::int_array_type &array)
+                { return nlohmann::json(nlohmann::json::array_t(array.begin(), array.end())); },
             },
             value.impl().variant);
     }
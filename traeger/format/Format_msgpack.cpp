@@ -1,7 +1,9 @@
 // SPDX-License-Identifier: BSL-1.0
 
+#include <cstdint>
 #include <variant>
 #include <string>
+#include <string_view>
 #include <utility>
 
 #include <msgpack.hpp>
@@ -44,27 +46,24 @@ namespace
 
     auto list_from_msgpack(const msgpack::object &object) -> List
     {
-        List list;
         const auto begin = object.via.array.ptr;
         const auto end = begin + object.via.array.size;
-        for (auto iter = begin; iter != end; ++iter)
-        {
-            list.append(value_from_msgpack(*iter));
-        }
-        return list;
+        return List::from_range(begin, end,
+                                [](const msgpack::object &item)
+                                { return value_from_msgpack(item); });
     }
 
     auto map_from_msgpack(const msgpack::object &object) -> Map
     {
-        Map map;
         const auto begin = object.via.map.ptr;
         const auto end = begin + object.via.map.size;
-        for (auto iter = begin; iter != end; ++iter)
-        {
-            map.set(String{iter->key.via.str.ptr, iter->key.via.str.size},
-                    value_from_msgpack(iter->val));
-        }
-        return map;
+        return Map::from_pairs(begin, end,
+                               [](const msgpack::object_kv &item)
+                               {
+                                   const auto &key = item.key.via.str;
+                                   return std::pair{Atom{std::string_view{key.ptr, key.size}},
+                                                    value_from_msgpack(item.val)};
+                               });
     }
 
     auto value_from_msgpack(const msgpack::object &object) -> Value
@@ -85,6 +84,8 @@ namespace
             return object.via.f64;
         case msgpack::type::STR:
             return String(object.via.str.ptr, object.via.str.size);
+        case msgpack::type::BIN:
+            return Blob{object.via.bin.ptr, object.via.bin.size};
         case msgpack::type::ARRAY:
             return list_from_msgpack(object);
         case msgpack::type::MAP:
@@ -98,7 +99,7 @@ namespace
         packer.pack_array(values.size());
         for (const auto &value : values)
         {
-            pack(packer, value.get());
+            pack(packer, value);
         }
     }
 
@@ -108,11 +109,22 @@ namespace
         packer.pack_map(values.size());
         for (const auto &[key, value] : values)
         {
-            packer.pack(key);
+            packer.pack(key.str());
             pack(packer, value.get());
         }
     }
 
+    template <typename Array>
+    auto pack_array(Packer &packer,
+                    const Array &array) -> void
+    {
+        packer.pack_array(static_cast<std::uint32_t>(array.size()));
+        for (const auto element : array)
+        {
+            packer.pack(element);
+        }
+    }
+
     auto pack(Packer &packer,
               const Value &value) -> void
     {
@@ -122,12 +134,25 @@ namespace
                 { packer.pack_nil(); },
                 [&packer](auto scalar)
                 { packer.pack(scalar); },
-                [&packer](const Value::impl_type::string_type &boxed)
-                { packer.pack(boxed.get()); },
+                [&packer](const Value::impl_type::string_type &string)
+                {
+                    const auto view = string.view();
+                    packer.pack_str(static_cast<std::uint32_t>(view.size()));
+                    packer.pack_str_body(view.data(), static_cast<std::uint32_t>(view.size()));
+                },
                 [&packer](const Value::impl_type::list_type &values)
                 { pack(packer, values); },
                 [&packer](const Value::impl_type::map_type &values)
                 { pack(packer, values); },
+                [&packer](const Blob &blob)
+                {
+                    packer.pack_bin(static_cast<std::uint32_t>(blob.size()));
+                    packer.pack_bin_body(blob.data(), static_cast<std::uint32_t>(blob.size()));
+                },
+                [&packer](const Value::impl_type::float_array_type &array)
+                { pack_array(packer, array); },
+                [&packer](const Value::impl_type::int_array_type &array)
+                { pack_array(packer, array); },
             },
             value.impl().variant);
     }
@@ -1,5 +1,6 @@
 // SPDX-License-Identifier: BSL-1.0
 
+#include <utility>
 #include <variant>
 
 #include <yaml-cpp/yaml.h>
@@ -28,28 +29,20 @@ namespace
     auto yaml_from(const Value::impl_type::map_type &values) -> YAML::Node;
     auto yaml_from(const Value &value) -> YAML::Node;
 
+    const auto binary_tag = String{"tag:yaml.org,2002:binary"};
+
     auto list_from_yaml(const YAML::Node &object) -> List
     {
-        List list;
-        const auto begin = object.begin();
-        const auto end = object.end();
-        for (auto it = begin; it != end; ++it)
-        {
-            list.append(value_from_yaml(*it));
-        }
-        return list;
+        return List::from_range(object.begin(), object.end(),
+                                [](const YAML::Node &item)
+                                { return value_from_yaml(item); });
     }
 
     auto map_from_yaml(const YAML::Node &object) -> Map
     {
-        Map map;
-        const auto begin = object.begin();
-        const auto end = object.end();
-        for (auto it = object.begin(); it != end; ++it)
-        {
-            map.set(it->first.as<String>(), value_from_yaml(it->second));
-        }
-        return map;
+        return Map::from_pairs(object.begin(), object.end(),
+                               [](const auto &item)
+                               { return std::pair{Atom{item.first.template as<String>()}, value_from_yaml(item.second)}; });
     }
 
     auto value_from_yaml(const YAML::Node &object) -> Value
@@ -60,6 +53,11 @@ namespace
         case YAML::NodeType::value::Null:
             return nullptr;
         case YAML::NodeType::value::Scalar:
+            if (object.Tag() == binary_tag)
+            {
+                const auto binary = object.as<YAML::Binary>();
+                return Blob{reinterpret_cast<const char *>(binary.data()), binary.size()};
+            }
             return object.as<String>();
         case YAML::NodeType::value::Sequence:
             return list_from_yaml(object);
@@ -83,7 +81,18 @@ namespace
         YAML::Node object;
         for (const auto &[key, value] : values)
         {
-            object[key] = yaml_from(value);
+            object[key.str()] = yaml_from(value);
+        }
+        return object;
+    }
+
+    template <typename Array>
+    auto yaml_from_array(const Array &array) -> YAML::Node
+    {
+        YAML::Node object{YAML::NodeType::Sequence};
+        for (const auto element : array)
+        {
+            object.push_back(element);
         }
         return object;
     }
@@ -96,12 +105,23 @@ namespace
                 { return YAML::Node(); },
                 [](auto scalar)
                 { return YAML::Node(scalar); },
-                [](const Value::impl_type::string_type &boxed)
-                { return YAML::Node(boxed.get()); },
+                [](const Value::impl_type::string_type &string)
+                { return YAML::Node(String{string.view()}); },
                 [](const Value::impl_type::list_type &values)
                 { return yaml_from(values); },
                 [](const Value::impl_type::map_type &values)
                 { return yaml_from(values); },
+                [](const Blob &blob)
+                {
+                    const auto *data = reinterpret_cast<const unsigned char *>(blob.data());
+                    auto object = YAML::Node(YAML::Binary{data, blob.size()});
+                    object.SetTag(binary_tag);
+                    return object;
+                },
+                [](const Value::impl_type::float_array_type &array)
+                { return yaml_from_array(array); },
+                [](const Value::impl_type::int_array_type &array)
+                { return yaml_from_array(array); },
             },
             value.impl().variant);
     }
@@ -4,6 +4,7 @@
 #include <utility>
 #include <memory>
 #include <iostream>
+#include <string_view>
 
 #include <zmq.hpp>
 
@@ -44,18 +45,25 @@ namespace traeger
             {
             }
 
+            // The frames are handed over as blobs that keep the zmq message
+            // alive, so the payload is never copied.
             auto recv() -> Value
             {
                 List messages;
                 while (true)
                 {
-                    zmq::message_t message;
-                    if (!socket_.recv(message, zmq::recv_flags::dontwait))
+                    auto message = std::make_unique<zmq::message_t>();
+                    if (!socket_.recv(*message, zmq::recv_flags::dontwait))
                     {
                         return Value{nullptr};
                     }
-                    messages.append(message.to_string());
-                    if (!message.more())
+                    const auto more = message->more();
+                    auto *frame = message.release();
+                    messages.append(Blob{frame->data<char>(),
+                                         frame->size(),
+                                         [frame]
+                                         { delete frame; }});
+                    if (!more)
                     {
                         break;
                     }
@@ -72,8 +80,7 @@ namespace traeger
                     const auto flags = message_index != message_count - 1
                                            ? zmq::send_flags::dontwait | zmq::send_flags::sndmore
                                            : zmq::send_flags::dontwait;
-                    if (const auto &message = *value.get_string();
-                        !socket_.send(zmq::buffer(message), flags))
+                    if (!send_frame(value, flags))
                     {
                         return Value{nullptr};
                     }
@@ -82,6 +89,26 @@ namespace traeger
                 return Value{message_count};
             }
 
+            // Blobs are sent without copying, the message holds a reference
+            // to the blob until zmq is done with it.
+            auto send_frame(const Value &value,
+                            const zmq::send_flags flags) -> bool
+            {
+                if (const auto blob = value.get_blob(); blob && !blob->empty())
+                {
+                    auto *hint = new Blob{blob.value()};
+                    zmq::message_t message{
+                        const_cast<char *>(hint->data()),
+                        hint->size(),
+                        [](void *, void *hint)
+                        { delete static_cast<Blob *>(hint); },
+                        hint};
+                    return socket_.send(message, flags).has_value();
+                }
+                const auto message = value.get_string().value_or(std::string_view{});
+                return socket_.send(zmq::buffer(message), flags).has_value();
+            }
+
             std::shared_ptr<impl_type> impl_;
             zmq::socket_t socket_;
         };
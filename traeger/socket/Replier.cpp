@@ -6,6 +6,7 @@
 #include "traeger/format/Format.hpp"
 #include "traeger/actor/Result.hpp"
 #include "traeger/actor/Scheduler.hpp"
+#include "traeger/actor/Pool.hpp"
 #include "traeger/actor/Promise.hpp"
 #include "traeger/actor/Mailbox.hpp"
 #include "traeger/socket/Replier.hpp"
@@ -36,20 +37,20 @@ namespace
     auto reply(const List &messages,
                const std::shared_ptr<reply_closure> &closure) -> Result
     {
-        String id, message_name, format_name, request;
+        Blob id, message_name, format_name, request;
         if (auto [unpack_ok, unpack_error] = messages.unpack(id, message_name, format_name, request);
             !unpack_ok)
         {
             return Result{Error{"unpacking frames: " + unpack_error}};
         }
 
-        auto format = Format::by_name(format_name);
+        auto format = Format::by_name(String{format_name.view()});
         if (!format)
         {
-            return Result{Error{"no such format " + format_name}};
+            return Result{Error{"no such format " + String{format_name.view()}}};
         }
 
-        auto &&[decoded, decoded_error] = format->decode(request);
+        auto &&[decoded, decoded_error] = format->decode(request.view());
         if (!decoded)
         {
             return Result{Error{std::move(decoded_error)}};
@@ -63,7 +64,7 @@ namespace
         const auto &arguments = std::move(maybe_arguments).value();
 
         closure->mailbox
-            .send(closure->scheduler, message_name, arguments)
+            .send(closure->scheduler, String{message_name.view()}, arguments)
             .then(
                 [format, closure, id](const Value &value) -> Result
                 {
@@ -74,12 +75,14 @@ namespace
                     }
                     closure->router.send(closure->scheduler, {id, std::move(encoded).value(), Error{}});
                     return Result{Value{nullptr}};
-                })
+                },
+                Promise::Execution::Inline)
             .fail(
                 [closure, id](const Error &error)
                 {
                     closure->router.send(closure->scheduler, {id, String{}, Error{error}});
-                });
+                },
+                Promise::Execution::Inline);
 
         return Result{Value{nullptr}};
     }
@@ -104,12 +107,14 @@ namespace
                     return reply(optional.value(), reply_closure);
                 }
                 return {};
-            });
+            },
+            Promise::Execution::Inline);
         recv_promise.fail(
             [reply_closure](const Error &error)
             {
                 reply_closure->promise.set_result(Result{error});
-            });
+            },
+            Promise::Execution::Inline);
     }
 }
 
@@ -124,7 +129,7 @@ namespace traeger
                         const Mailbox &mailbox) const noexcept -> Promise
     {
         Promise promise{scheduler};
-        schedule_reply(std::make_shared<reply_closure>(scheduler, mailbox, promise, router_));
+        schedule_reply(make_pooled<reply_closure>(scheduler, mailbox, promise, router_));
         return promise;
     }
 }
@@ -44,13 +44,14 @@ namespace traeger
                     [impl = shared_from_this(), scheduler](const Value &) -> Promise
                     {
                         return impl->dealer_.recv(scheduler);
-                    })
+                    },
+                    Promise::Execution::Inline)
                 .then(
                     [impl = shared_from_this()](const Value &value) -> Result
                     {
                         const auto list = value.get_list().value();
-                        String response;
-                        String response_error;
+                        Blob response;
+                        Blob response_error;
                         if (auto [unpack_ok, unpack_error] = list.unpack(response, response_error);
                             !unpack_ok)
                         {
@@ -58,15 +59,16 @@ namespace traeger
                         }
                         if (response.empty())
                         {
-                            return Result{Error{response_error}};
+                            return Result{Error{String{response_error.view()}}};
                         }
-                        auto [decoded, decode_error] = impl->format_.decode(response);
+                        auto [decoded, decode_error] = impl->format_.decode(response.view());
                         if (!decoded)
                         {
                             return Result{Error{decode_error}};
                         }
                         return Result{decoded.value()};
-                    });
+                    },
+                    Promise::Execution::Inline);
         }
 
     private:
@@ -7,6 +7,7 @@
 
 #include "traeger/actor/Result.hpp"
 #include "traeger/actor/Scheduler.hpp"
+#include "traeger/actor/Pool.hpp"
 #include "traeger/actor/Promise.hpp"
 #include "traeger/socket/Context.hpp"
 #include "traeger/socket/Socket.hpp"
@@ -57,10 +58,12 @@ namespace
                         closure->promise.set_result(Result{value});
                     }
                     return {};
-                })
+                },
+                Promise::Execution::Inline)
             .fail(
                 [closure](const Error &error)
-                { closure->promise.set_result(Result{error}); });
+                { closure->promise.set_result(Result{error}); },
+                Promise::Execution::Inline);
     }
 
     auto schedule_send(const std::shared_ptr<socket_closure> &socket_closure) noexcept -> void
@@ -87,12 +90,14 @@ namespace
                     socket_closure->promise.set_result(Result{value});
                 }
                 return {};
-            });
+            },
+            Promise::Execution::Inline);
         send_promise.fail(
             [socket_closure](const Error &error)
             {
                 socket_closure->promise.set_result(Result{error});
-            });
+            },
+            Promise::Execution::Inline);
     }
 }
 
@@ -106,7 +111,7 @@ namespace traeger
     auto Socket::recv(const Scheduler &scheduler) const noexcept -> Promise
     {
         Promise promise{scheduler};
-        const auto closure = std::make_shared<socket_closure>(
+        const auto closure = make_pooled<socket_closure>(
             scheduler,
             mailbox_,
             promise,
@@ -116,7 +121,7 @@ namespace traeger
     }
 
     auto Socket::send(const Scheduler &scheduler,
-                      std::vector<String> &&messages) const noexcept -> Promise
+                      std::vector<Value> &&messages) const noexcept -> Promise
     {
         Promise promise{scheduler};
         List list;
@@ -124,7 +129,7 @@ namespace traeger
         {
             list.append(std::move(message));
         }
-        const auto closure = std::make_shared<socket_closure>(
+        const auto closure = make_pooled<socket_closure>(
             scheduler,
             mailbox_, promise,
             make_list(list));
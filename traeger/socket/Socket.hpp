@@ -14,7 +14,7 @@ namespace traeger
     struct Socket
     {
         auto send(const Scheduler &scheduler,
-                  std::vector<String> &&messages) const noexcept -> Promise;
+                  std::vector<Value> &&messages) const noexcept -> Promise;
 
         auto recv(const Scheduler &scheduler) const noexcept -> Promise;
 
@@ -7,6 +7,7 @@
 #include "traeger/format/Format.hpp"
 #include "traeger/actor/Result.hpp"
 #include "traeger/actor/Scheduler.hpp"
+#include "traeger/actor/Pool.hpp"
 #include "traeger/actor/Promise.hpp"
 #include "traeger/socket/Subscriber.hpp"
 
@@ -36,26 +37,26 @@ namespace
     auto listen(const List &messages,
                 const std::shared_ptr<listen_closure> &closure) -> Result
     {
-        String topic, format_name, encoded_message;
+        Blob topic, format_name, encoded_message;
         if (auto [unpack_ok, unpack_error] = messages.unpack(topic, format_name, encoded_message);
             !unpack_ok)
         {
             return Result{Error{"unpacking frames: " + unpack_error}};
         }
 
-        const auto *format = Format::by_name(format_name);
+        const auto *format = Format::by_name(String{format_name.view()});
         if (!format)
         {
-            return Result{Error{"no such format " + format_name}};
+            return Result{Error{"no such format " + String{format_name.view()}}};
         }
 
-        auto &&[decoded, decoded_error] = format->decode(encoded_message);
+        auto &&[decoded, decoded_error] = format->decode(encoded_message.view());
         if (!decoded)
         {
             return Result{Error{std::move(decoded_error)}};
         }
 
-        closure->callback(std::move(topic), std::move(decoded).value());
+        closure->callback(String{topic.view()}, std::move(decoded).value());
         return Result{Value{nullptr}};
     }
 
@@ -78,12 +79,14 @@ namespace
                     return listen(optional.value(), listen_closure);
                 }
                 return {};
-            });
+            },
+            Promise::Execution::Inline);
         recv_promise.fail(
             [listen_closure](const Error &error)
             {
                 listen_closure->promise.set_result(Result{error});
-            });
+            },
+            Promise::Execution::Inline);
     }
 }
 
@@ -98,7 +101,7 @@ namespace traeger
                             Callback &&callback) const noexcept -> Promise
     {
         Promise promise{scheduler};
-        schedule_listen(std::make_shared<listen_closure>(scheduler, std::move(callback), promise, subscriber_));
+        schedule_listen(make_pooled<listen_closure>(scheduler, std::move(callback), promise, subscriber_));
         return promise;
     }
 }
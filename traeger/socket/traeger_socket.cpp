@@ -23,9 +23,9 @@ namespace
         result.reserve(list.size());
         for (const auto &value : list)
         {
-            if (const auto *s = value.get_string(); s)
+            if (const auto s = value.get_string(); s)
             {
-                result.push_back(*s);
+                result.emplace_back(*s);
             }
         }
         return result;
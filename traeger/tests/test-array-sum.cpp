@@ -0,0 +1,63 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <catch2/catch_test_macros.hpp>
+#include <traeger/value/Array.hpp>
+#include <traeger/value/Value.hpp>
+
+TEST_CASE("Array.sum")
+{
+    using namespace traeger;
+
+    SECTION("float")
+    {
+        auto array = FloatArray{};
+        REQUIRE(array.sum() == 0.0);
+        for (int n = 1; n <= 100; ++n)
+        {
+            array.append(static_cast<Float>(n));
+        }
+        REQUIRE(array.size() == 100);
+        REQUIRE(array.sum() == 5050.0);
+        REQUIRE(array.min() == 1.0);
+        REQUIRE(array.max() == 100.0);
+    }
+
+    SECTION("int")
+    {
+        const auto array = IntArray{3, -1, 4, 1, -5, 9, 2, 6, 5, 3, 5};
+        REQUIRE(array.sum() == 32);
+        REQUIRE(array.min() == -5);
+        REQUIRE(array.max() == 9);
+        REQUIRE(array.get(-1) == 5);
+        REQUIRE_FALSE(array.get(11));
+    }
+
+    SECTION("empty")
+    {
+        const auto array = IntArray{};
+        REQUIRE(array.empty());
+        REQUIRE_FALSE(array.min());
+        REQUIRE_FALSE(array.max());
+    }
+
+    SECTION("dot")
+    {
+        const auto left = FloatArray{1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0};
+        const auto right = FloatArray{9.0, 8.0, 7.0, 6.0, 5.0, 4.0, 3.0, 2.0, 1.0};
+        REQUIRE(left.dot(right) == 165.0);
+        REQUIRE_FALSE(left.dot(FloatArray{1.0}));
+    }
+
+    SECTION("value")
+    {
+        auto array = IntArray{1, 2, 3};
+        const auto value = Value{array};
+        REQUIRE(value.type() == Value::Type::IntArray);
+        REQUIRE(value.get<IntArray>().value().data() == array.data());
+        REQUIRE(array.set(0, 10));
+        REQUIRE(value.get<IntArray>().value().sum() == 6);
+        REQUIRE(value != Value{array});
+        REQUIRE_FALSE(value.get<FloatArray>());
+        REQUIRE_FALSE(value.get_list());
+    }
+}
@@ -0,0 +1,116 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <traeger/value/Atom.hpp>
+#include <traeger/value/Map.hpp>
+#include <traeger/value/Value.hpp>
+
+TEST_CASE("Atom.atom")
+{
+    using namespace traeger;
+
+    SECTION("short atoms are interned")
+    {
+        const auto a = Atom{"key"};
+        const auto b = Atom{String{"key"}};
+        REQUIRE(a.interned());
+        REQUIRE(a == b);
+        REQUIRE(a.str().data() == b.str().data());
+        REQUIRE(a.hash() == b.hash());
+        REQUIRE(a != Atom{"other"});
+    }
+
+    SECTION("long atoms are not interned")
+    {
+        const auto string = String(100, 'x');
+        const auto a = Atom{string};
+        const auto b = Atom{string};
+        REQUIRE_FALSE(a.interned());
+        REQUIRE(a == b);
+        REQUIRE(a.str() == string);
+        REQUIRE(a != Atom{String(100, 'y')});
+    }
+
+    SECTION("moved from atom is empty")
+    {
+        auto a = Atom{"key"};
+        const auto b = std::move(a);
+        REQUIRE(b.str() == "key");
+        REQUIRE(a == Atom{});
+    }
+
+    SECTION("map keys")
+    {
+        auto map = make_map("b", true, "i", 123);
+        REQUIRE(*map.find(Atom{"i"}) == 123);
+        REQUIRE(map.contains(Atom{"b"}));
+
+        map.set(Atom{"f"}, 3.1416);
+        REQUIRE(*map.find("f") == 3.1416);
+
+        map.erase(Atom{"b"});
+        REQUIRE_FALSE(map.contains("b"));
+    }
+
+    SECTION("lookups do not intern")
+    {
+        auto map = make_map("present", 1);
+        REQUIRE(Atom::find("present") == Atom{"present"});
+
+        REQUIRE(map.find("never interned") == nullptr);
+        REQUIRE_FALSE(map.contains("never interned"));
+        map.erase("never interned");
+        REQUIRE(map.get_in(make_list("never interned", "either")) == nullptr);
+        REQUIRE_FALSE(Atom::find("never interned"));
+
+        REQUIRE(map.set_in(make_list("stored"), 2));
+        REQUIRE(Atom::find("stored"));
+        REQUIRE(*map.find("stored") == 2);
+
+        const auto string = String(100, 'x');
+        map.set(string, 3);
+        REQUIRE(*map.find(string) == 3);
+    }
+
+    SECTION("empty atom is interned")
+    {
+        REQUIRE(Atom{}.interned());
+        REQUIRE(Atom{""} == Atom{});
+        REQUIRE(Atom::find("") == Atom{});
+    }
+
+    SECTION("concurrent interning")
+    {
+        constexpr auto n_threads = 4;
+        constexpr auto n_keys = 256;
+        auto atoms = std::vector<std::vector<Atom>>(n_threads);
+        auto threads = std::vector<std::thread>{};
+        for (auto t = 0; t < n_threads; ++t)
+        {
+            threads.emplace_back([&atoms, t]
+                                 {
+                                     for (auto n = 0; n < n_keys; ++n)
+                                     {
+                                         atoms[t].emplace_back("concurrent " + std::to_string(n));
+                                     } });
+        }
+        for (auto &thread : threads)
+        {
+            thread.join();
+        }
+        for (auto n = 0; n < n_keys; ++n)
+        {
+            const auto key = "concurrent " + std::to_string(n);
+            for (auto t = 0; t < n_threads; ++t)
+            {
+                REQUIRE(atoms[t][n].interned());
+                REQUIRE(atoms[t][n].str().data() == atoms[0][n].str().data());
+            }
+            REQUIRE(Atom::find(key) == atoms[0][n]);
+        }
+    }
+}
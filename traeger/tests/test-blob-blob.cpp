@@ -0,0 +1,58 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <string_view>
+
+#include <catch2/catch_test_macros.hpp>
+#include <traeger/value/Blob.hpp>
+#include <traeger/value/Value.hpp>
+
+TEST_CASE("Blob.blob")
+{
+    using namespace traeger;
+
+    SECTION("copied bytes")
+    {
+        const char bytes[] = {'\x00', '\x01', '\x02', '\xff'};
+        const auto blob = Blob{bytes, sizeof(bytes)};
+        REQUIRE(blob.size() == 4);
+        REQUIRE(blob.data() != bytes);
+        REQUIRE(blob.view() == std::string_view{bytes, sizeof(bytes)});
+        REQUIRE(blob == Blob{std::string_view{bytes, sizeof(bytes)}});
+        REQUIRE(blob != Blob{bytes, 2});
+    }
+
+    SECTION("empty")
+    {
+        const auto blob = Blob{};
+        REQUIRE(blob.empty());
+        REQUIRE(blob == Blob{std::string_view{}});
+    }
+
+    SECTION("foreign memory is released by the last copy")
+    {
+        static const char bytes[] = "Hello world";
+        int released = 0;
+        {
+            const auto blob = Blob{bytes, sizeof(bytes) - 1, [&released]
+                                   { ++released; }};
+            REQUIRE(blob.data() == bytes);
+            {
+                const auto copy = blob;
+                REQUIRE(copy.data() == bytes);
+            }
+            REQUIRE(released == 0);
+        }
+        REQUIRE(released == 1);
+    }
+
+    SECTION("value")
+    {
+        const auto blob = Blob{std::string_view{"Hello world"}};
+        const auto value = Value{blob};
+        REQUIRE(value.type() == Value::Type::Blob);
+        REQUIRE(value.type_name() == "Blob");
+        REQUIRE(value.get<Blob>().value().data() == blob.data());
+        REQUIRE_FALSE(value.get_string());
+        REQUIRE(value != Value{"Hello world"});
+    }
+}
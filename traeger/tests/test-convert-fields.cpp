@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <catch2/catch_test_macros.hpp>
+#include <traeger/value/Convert.hpp>
+#include <traeger/value/Value.hpp>
+
+namespace
+{
+    struct Point
+    {
+        traeger::Int x;
+        traeger::Int y;
+    };
+
+    TRAEGER_FIELDS(Point, x, y)
+
+    struct Segment
+    {
+        traeger::String name;
+        Point begin;
+        Point end;
+    };
+
+    TRAEGER_FIELDS(Segment, name, begin, end)
+}
+
+TEST_CASE("Convert.fields")
+{
+    using namespace traeger;
+
+    SECTION("to value")
+    {
+        const auto value = Value{Point{1, 2}};
+        REQUIRE(value.type() == Value::Type::Map);
+
+        Map map;
+        map.set("x", 1, "y", 2);
+        REQUIRE(value == map);
+    }
+
+    SECTION("from value")
+    {
+        Map map;
+        map.set("x", 3, "y", 4);
+        const auto point = Value{map}.get<Point>();
+        REQUIRE(point);
+        REQUIRE(point->x == 3);
+        REQUIRE(point->y == 4);
+    }
+
+    SECTION("nested")
+    {
+        const auto value = Value{Segment{"diagonal", Point{0, 0}, Point{5, 5}}};
+        const auto segment = value.get<Segment>();
+        REQUIRE(segment);
+        REQUIRE(segment->name == "diagonal");
+        REQUIRE(segment->end.x == 5);
+        REQUIRE(segment->end.y == 5);
+    }
+
+    SECTION("missing field")
+    {
+        Map map;
+        map.set("x", 3);
+        REQUIRE_FALSE(Value{map}.get<Point>());
+    }
+
+    SECTION("list")
+    {
+        const auto list = make_list(Point{1, 2}, 10);
+        const auto [tuple, error] = list.try_get_tuple<Point, Int>();
+        REQUIRE(tuple);
+        REQUIRE(std::get<0>(*tuple).y == 2);
+
+        const auto [wrong_tuple, wrong_error] = list.try_get_tuple<Int, Point>();
+        REQUIRE_FALSE(wrong_tuple);
+        REQUIRE(wrong_error.message() == "invalid cast in argument 0 from type Map to Int");
+    }
+}
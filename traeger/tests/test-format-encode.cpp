@@ -1,5 +1,7 @@
 // SPDX-License-Identifier: BSL-1.0
 
+#include <string_view>
+
 #include <catch2/catch_test_macros.hpp>
 #include <traeger/value/Value.hpp>
 #include <traeger/format/Format.hpp>
@@ -26,6 +28,34 @@ TEST_CASE("Format.encode")
             REQUIRE(*decoded_optional == "Hello world");
         }
 
+        SECTION("blob")
+        {
+            const auto blob = Blob{std::string_view{"\x00\x01\x02\xff", 4}};
+
+            auto [encoded_optional, encoded_error] = format.encode(blob);
+            REQUIRE(encoded_error.empty());
+            REQUIRE(encoded_optional.has_value());
+
+            const auto [decoded_optional, decoded_error] = format.decode(*encoded_optional);
+            REQUIRE(decoded_error.empty());
+            REQUIRE(decoded_optional.has_value());
+            REQUIRE(*decoded_optional == "AAEC/w==");
+        }
+
+        SECTION("array")
+        {
+            const auto array = IntArray{1, 2, 3};
+
+            auto [encoded_optional, encoded_error] = format.encode(array);
+            REQUIRE(encoded_error.empty());
+            REQUIRE(encoded_optional.has_value());
+
+            const auto [decoded_optional, decoded_error] = format.decode(*encoded_optional);
+            REQUIRE(decoded_error.empty());
+            REQUIRE(decoded_optional.has_value());
+            REQUIRE(*decoded_optional == make_list(1, 2, 3));
+        }
+
         SECTION("list")
         {
             const auto list = make_list(nullptr,
@@ -93,6 +123,20 @@ TEST_CASE("Format.encode")
             REQUIRE(*decoded_optional == "Hello world");
         }
 
+        SECTION("blob")
+        {
+            const auto blob = Blob{std::string_view{"\x00\x01\x02\xff", 4}};
+
+            auto [encoded_optional, encoded_error] = format.encode(blob);
+            REQUIRE(encoded_error.empty());
+            REQUIRE(encoded_optional.has_value());
+
+            const auto [decoded_optional, decoded_error] = format.decode(*encoded_optional);
+            REQUIRE(decoded_error.empty());
+            REQUIRE(decoded_optional.has_value());
+            REQUIRE(*decoded_optional == blob);
+        }
+
         SECTION("list")
         {
             const auto list = make_list(nullptr,
@@ -160,6 +204,34 @@ TEST_CASE("Format.encode")
             REQUIRE(*decoded_optional == "Hello world");
         }
 
+        SECTION("blob")
+        {
+            const auto blob = Blob{std::string_view{"\x00\x01\x02\xff", 4}};
+
+            auto [encoded_optional, encoded_error] = format.encode(blob);
+            REQUIRE(encoded_error.empty());
+            REQUIRE(encoded_optional.has_value());
+
+            const auto [decoded_optional, decoded_error] = format.decode(*encoded_optional);
+            REQUIRE(decoded_error.empty());
+            REQUIRE(decoded_optional.has_value());
+            REQUIRE(*decoded_optional == blob);
+        }
+
+        SECTION("array")
+        {
+            const auto array = IntArray{1, 2, 3};
+
+            auto [encoded_optional, encoded_error] = format.encode(array);
+            REQUIRE(encoded_error.empty());
+            REQUIRE(encoded_optional.has_value());
+
+            const auto [decoded_optional, decoded_error] = format.decode(*encoded_optional);
+            REQUIRE(decoded_error.empty());
+            REQUIRE(decoded_optional.has_value());
+            REQUIRE(*decoded_optional == make_list(1, 2, 3));
+        }
+
         SECTION("list")
         {
             const auto list = make_list(nullptr,
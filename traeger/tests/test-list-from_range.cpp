@@ -0,0 +1,63 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <traeger/value/Value.hpp>
+
+TEST_CASE("List.from_range")
+{
+    using namespace traeger;
+
+    SECTION("values")
+    {
+        const Value values[]{1, "two", make_list(3)};
+        REQUIRE(List::from_range(std::begin(values), std::end(values)) == make_list(1, "two", make_list(3)));
+        REQUIRE(List::from_range(std::vector<Value>{4, 5}) == make_list(4, 5));
+        REQUIRE(List::from_range(std::vector<Value>{}).empty());
+    }
+
+    SECTION("scalars")
+    {
+        auto list = make_list("head");
+        const Int ints[]{1, 2, 3};
+        const Float floats[]{0.5};
+        const Bool bools[]{true, false};
+        const UInt uints[]{7};
+        list.append_range(std::begin(ints), std::end(ints));
+        list.append_range(std::begin(floats), std::end(floats));
+        list.append_range(std::begin(bools), std::end(bools));
+        list.append_range(std::begin(uints), std::end(uints));
+        REQUIRE(list == make_list("head", 1, 2, 3, 0.5, true, false, UInt{7}));
+    }
+
+    SECTION("transform")
+    {
+        const int numbers[]{1, 2, 3};
+        const auto list = List::from_range(std::begin(numbers), std::end(numbers),
+                                           [](int number)
+                                           { return make_list(number, number * number); });
+        REQUIRE(list == make_list(make_list(1, 1), make_list(2, 4), make_list(3, 9)));
+        REQUIRE(List::from_range(std::begin(numbers), std::begin(numbers),
+                                 [](int number)
+                                 { return Value{number}; })
+                    .empty());
+    }
+
+    SECTION("throwing transform")
+    {
+        const int numbers[]{1, 2, 3};
+        REQUIRE_THROWS_AS(List::from_range(std::begin(numbers), std::end(numbers),
+                                           [](int number) -> Value
+                                           {
+                                               if (number == 2)
+                                               {
+                                                   throw std::invalid_argument{"two"};
+                                               }
+                                               return number;
+                                           }),
+                          std::invalid_argument);
+    }
+}
@@ -16,7 +16,7 @@ TEST_CASE("List.iter")
         std::vector<String> values;
         for (const auto &value : list)
         {
-            values.push_back(*value.get_string());
+            values.emplace_back(*value.get_string());
         }
         REQUIRE(values == std::vector<String>{"A3", "B2", "C1", "D0"});
     }
@@ -29,7 +29,7 @@ TEST_CASE("List.iter")
             do
             {
                 const auto &value = iter.value();
-                values.push_back(*value.get_string());
+                values.emplace_back(*value.get_string());
             } while (iter.increment());
         }
         REQUIRE(values == std::vector<String>{"A3", "B2", "C1", "D0"});
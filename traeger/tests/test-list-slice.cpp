@@ -0,0 +1,65 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <catch2/catch_test_macros.hpp>
+#include <traeger/value/Value.hpp>
+
+TEST_CASE("List.slice")
+{
+    using namespace traeger;
+
+    auto list = List{};
+    for (int n = 0; n < 1000; ++n)
+    {
+        list.append(n);
+    }
+
+    SECTION("slice")
+    {
+        REQUIRE(list.slice(0, 3) == make_list(0, 1, 2));
+        REQUIRE(list.slice(-2, 1000) == make_list(998, 999));
+        REQUIRE(list.slice(998, 2000) == make_list(998, 999));
+        REQUIRE(list.slice(5, 2).empty());
+        REQUIRE(list.slice(0, 1000) == list);
+        REQUIRE(list.size() == 1000);
+    }
+
+    SECTION("concat")
+    {
+        const auto chunks = make_list(list.slice(0, 500), list.slice(500, 1000));
+        const auto first = chunks.find(0)->get_list().value();
+        const auto second = chunks.find(1)->get_list().value();
+        REQUIRE(first.concat(second) == list);
+        REQUIRE(make_list(1).concat(List{}) == make_list(1));
+    }
+
+    SECTION("insert")
+    {
+        auto small = make_list(1, 3);
+        REQUIRE(small.insert(1, 2));
+        REQUIRE(small.insert(3, 4));
+        REQUIRE(small.insert(0, 0));
+        REQUIRE_FALSE(small.insert(6, 6));
+        REQUIRE(small == make_list(0, 1, 2, 3, 4));
+
+        REQUIRE(list.insert(500, "middle"));
+        REQUIRE(list.size() == 1001);
+        REQUIRE(*list.find(500) == Value{"middle"});
+        REQUIRE(*list.find(501) == Value{500});
+    }
+
+    SECTION("erase")
+    {
+        auto small = make_list(0, 1, 2);
+        REQUIRE(small.erase(1));
+        REQUIRE(small.erase(-1));
+        REQUIRE_FALSE(small.erase(1));
+        REQUIRE(small == make_list(0));
+    }
+
+    SECTION("leaf size")
+    {
+        const auto leaf_size = List::leaf_size();
+        REQUIRE(leaf_size > 0);
+        REQUIRE((leaf_size & (leaf_size - 1)) == 0);
+    }
+}
@@ -0,0 +1,52 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <catch2/catch_test_macros.hpp>
+#include <traeger/value/List.hpp>
+#include <traeger/value/Value.hpp>
+
+TEST_CASE("List.try_get_tuple")
+{
+    using namespace traeger;
+
+    SECTION("types match")
+    {
+        auto list = make_list(true, 10, "ten");
+        auto [tuple, error] = list.try_get_tuple<Bool, Int, String>();
+        REQUIRE(tuple);
+        REQUIRE_FALSE(error);
+        REQUIRE(std::get<0>(*tuple) == true);
+        REQUIRE(std::get<1>(*tuple) == 10);
+        REQUIRE(std::get<2>(*tuple) == "ten");
+    }
+
+    SECTION("types do not match")
+    {
+        auto list = make_list(true, 10, 3.1416);
+        auto [tuple, error] = list.try_get_tuple<Bool, String, Float>();
+        REQUIRE_FALSE(tuple);
+        REQUIRE(error.code == List::DecodeError::Code::Cast);
+        REQUIRE(error.index == 1);
+        REQUIRE(error.message() == "invalid cast in argument 1 from type Int to String");
+    }
+
+    SECTION("size does not match")
+    {
+        auto list = make_list(true, 10);
+        auto [tuple, error] = list.try_get_tuple<Bool, Int, Float>();
+        REQUIRE_FALSE(tuple);
+        REQUIRE(error.code == List::DecodeError::Code::Size);
+        REQUIRE(error.expected == 3);
+        REQUIRE(error.given == 2);
+        REQUIRE(error.message() == "expected 3 arguments but 2 were given");
+    }
+
+    SECTION("malformed number")
+    {
+        auto list = make_list("abc", "10");
+        auto [tuple, error] = list.try_get_tuple<Int, Int>();
+        REQUIRE_FALSE(tuple);
+        REQUIRE(error.code == List::DecodeError::Code::Cast);
+        REQUIRE(error.index == 0);
+        REQUIRE(make_list("10").try_get_tuple<Int>().first == std::tuple<Int>{10});
+    }
+}
@@ -0,0 +1,20 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <catch2/catch_test_macros.hpp>
+#include <traeger/value/Value.hpp>
+
+TEST_CASE("List.update_in")
+{
+    using namespace traeger;
+
+    auto list = make_list(make_map("id", 1, "tags", make_list("a")), 2);
+
+    REQUIRE(*list.get_in(make_list(0, "tags", 0)) == Value{"a"});
+    REQUIRE(list.set_in(make_list(0, "tags", 0), "b"));
+    REQUIRE(list.update_in(make_list(1),
+                           [](const Value &value) -> Value
+                           { return make_list(value); }));
+    REQUIRE(list == make_list(make_map("id", 1, "tags", make_list("b")), make_list(2)));
+    REQUIRE_FALSE(list.set_in(make_list(2), 3));
+    REQUIRE_FALSE(list.set_in(make_list("id"), 3));
+}
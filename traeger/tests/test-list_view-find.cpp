@@ -0,0 +1,33 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <catch2/catch_test_macros.hpp>
+#include <traeger/value/Value.hpp>
+
+TEST_CASE("ListView.find")
+{
+    using namespace traeger;
+
+    const auto value = Value{make_list(1, "two", make_list(3))};
+    const auto view = value.get_list_view();
+    REQUIRE(view);
+    const auto scalar = Value{1};
+    REQUIRE_FALSE(scalar.get_list_view());
+
+    REQUIRE(view->size() == 3);
+    REQUIRE_FALSE(view->empty());
+    REQUIRE(*view->find(0) == Value{1});
+    REQUIRE(*view->find(-1) == Value{make_list(3)});
+    REQUIRE(view->find(3) == nullptr);
+
+    // The elements are borrowed from the value and not copied.
+    REQUIRE(view->find(1) == value.get_list_view()->find(1));
+
+    auto count = 0;
+    for (const auto &element : view.value())
+    {
+        REQUIRE(element == *view->find(count));
+        ++count;
+    }
+    REQUIRE(count == 3);
+    REQUIRE(view->list() == make_list(1, "two", make_list(3)));
+}
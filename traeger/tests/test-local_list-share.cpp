@@ -0,0 +1,65 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <type_traits>
+
+#include <catch2/catch_test_macros.hpp>
+#include <traeger/value/LocalList.hpp>
+#include <traeger/value/Value.hpp>
+
+TEST_CASE("LocalList.share")
+{
+    using namespace traeger;
+
+    static_assert(!std::is_constructible_v<Value, LocalList>);
+    static_assert(!std::is_constructible_v<List, LocalList>);
+
+    SECTION("scratch")
+    {
+        auto local = LocalList{};
+        for (int n = 0; n < 100; ++n)
+        {
+            local.append(n);
+        }
+        REQUIRE(local.set(-1, 1000));
+        REQUIRE(local.size() == 100);
+
+        Int sum = 0;
+        for (const auto &value : local)
+        {
+            sum += value.get_int().value_or(0);
+        }
+        REQUIRE(sum == 99 * 98 / 2 + 1000);
+
+        const auto list = local.share();
+        REQUIRE(list.size() == 100);
+        REQUIRE(*list.find(0) == 0);
+        REQUIRE(*list.find(-1) == 1000);
+    }
+
+    SECTION("round trip")
+    {
+        const auto list = make_list(1, "two", make_list(3));
+        auto local = LocalList{list};
+        const auto copy = local;
+        local.append(4);
+        REQUIRE(copy.share() == list);
+        REQUIRE(local != copy);
+        REQUIRE(local.share() == make_list(1, "two", make_list(3), 4));
+    }
+
+    SECTION("nested")
+    {
+        const auto tree = make_list(make_map("id", 0, "tags", make_list("a")),
+                                    make_list(1, make_list(2, make_list(3))));
+        auto local = LocalList{tree};
+        auto inner = LocalList{local.find(1)->get_list().value()};
+        inner.append(4);
+        REQUIRE(local.set(1, inner.share()));
+
+        const auto expected = make_list(make_map("id", 0, "tags", make_list("a")),
+                                        make_list(1, make_list(2, make_list(3)), 4));
+        REQUIRE(local.share() == expected);
+        REQUIRE(LocalList{local.share()}.share() == expected);
+        REQUIRE(*tree.find(1) == make_list(1, make_list(2, make_list(3))));
+    }
+}
@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <type_traits>
+
+#include <catch2/catch_test_macros.hpp>
+#include <traeger/value/LocalList.hpp>
+#include <traeger/value/LocalMap.hpp>
+#include <traeger/value/Value.hpp>
+
+TEST_CASE("LocalMap.share")
+{
+    using namespace traeger;
+
+    static_assert(!std::is_constructible_v<Value, LocalMap>);
+    static_assert(!std::is_constructible_v<Map, LocalMap>);
+
+    SECTION("scratch")
+    {
+        auto local = LocalMap{};
+        local.set("x", 10);
+        local.set("y", 20);
+        local.erase("x");
+        REQUIRE_FALSE(local.contains("x"));
+        REQUIRE(*local.find("y") == 20);
+
+        const auto map = local.share();
+        REQUIRE(map == make_map("y", 20));
+    }
+
+    SECTION("round trip")
+    {
+        const auto map = make_map("name", "John", "age", 30);
+        auto local = LocalMap{map};
+        const auto copy = local;
+        local.set("age", 31);
+        REQUIRE(copy.share() == map);
+        REQUIRE(local != copy);
+        REQUIRE(local.share() == make_map("name", "John", "age", 31));
+    }
+
+    SECTION("nested")
+    {
+        auto items = LocalList{};
+        for (int n = 0; n < 3; ++n)
+        {
+            auto item = LocalMap{};
+            item.set("id", n);
+            item.set("tags", make_list("a", "b"));
+            items.append(item.share());
+        }
+        auto local = LocalMap{};
+        local.set("items", items.share());
+        local.set("count", 3);
+
+        const auto tree = make_map(
+            "count", 3,
+            "items", make_list(make_map("id", 0, "tags", make_list("a", "b")),
+                               make_map("id", 1, "tags", make_list("a", "b")),
+                               make_map("id", 2, "tags", make_list("a", "b"))));
+        REQUIRE(local.share() == tree);
+
+        const auto shared = local.share();
+        const auto round_trip = LocalMap{shared};
+        REQUIRE(round_trip.share() == tree);
+        const auto nested = LocalList{round_trip.find("items")->get_list().value()};
+        REQUIRE(Value{nested.share()} == *tree.find("items"));
+        REQUIRE(Value{LocalMap{nested.find(1)->get_map().value()}.share()} == *nested.find(1));
+    }
+}
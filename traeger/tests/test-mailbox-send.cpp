@@ -1,7 +1,12 @@
 // SPDX-License-Identifier: BSL-1.0
 
 #include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <chrono>
 #include <future>
+#include <memory>
+#include <optional>
+#include <thread>
 #include <traeger/actor/Scheduler.hpp>
 #include <traeger/actor/Mailbox.hpp>
 
@@ -41,6 +46,45 @@ namespace
             return promise;
         }
     };
+
+    // Shaped like a Requester, a send that never gets a reply keeps polling
+    // until the promise of the reply has a result.
+    struct PollingMailbox final : Mailbox::Interface
+    {
+        Promise
+        send(const Scheduler &scheduler,
+             const String &,
+             const List &) noexcept override
+        {
+            auto sent = Promise{scheduler};
+            sent.set_result(Result{Value{nullptr}});
+            const auto received = recv.emplace(scheduler);
+            return sent.then(
+                [this, scheduler, received](const Value &) -> Promise
+                {
+                    poll(scheduler, received);
+                    return received;
+                },
+                Promise::Execution::Inline);
+        }
+
+        auto poll(const Scheduler &scheduler,
+                  const Promise &promise) noexcept -> void
+        {
+            if (promise.has_result())
+            {
+                return;
+            }
+            ++polls;
+            scheduler.schedule_delayed(
+                std::chrono::milliseconds(1),
+                [this, scheduler, promise]
+                { poll(scheduler, promise); });
+        }
+
+        std::optional<Promise> recv;
+        std::atomic<int> polls{0};
+    };
 }
 
 TEST_CASE("Mailbox.send")
@@ -78,4 +122,21 @@ TEST_CASE("Mailbox.send")
 
         REQUIRE(promise_error.get_future().get() == Error{"Not a method"});
     }
-}
\ No newline at end of file
+
+    SECTION("deadline cancels the source")
+    {
+        using namespace std::chrono_literals;
+
+        const auto polling = std::make_shared<PollingMailbox>();
+        const auto mailbox = Mailbox{polling};
+        const auto promise = mailbox.send(scheduler, "recv", List{}, 20ms);
+        REQUIRE(promise.wait() == Result{Error::timeout()});
+
+        REQUIRE(polling->recv);
+        REQUIRE(polling->recv->wait() == Result{Error::cancelled()});
+        std::this_thread::sleep_for(10ms);
+        const auto polls = polling->polls.load();
+        std::this_thread::sleep_for(20ms);
+        REQUIRE(polling->polls == polls);
+    }
+}
@@ -0,0 +1,41 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <traeger/value/Value.hpp>
+
+TEST_CASE("Map.from_pairs")
+{
+    using namespace traeger;
+
+    SECTION("strings")
+    {
+        auto pairs = std::vector<std::pair<String, Value>>{};
+        pairs.emplace_back("a", 1);
+        pairs.emplace_back("b", make_list(2));
+        pairs.emplace_back("a", 3);
+        REQUIRE(Map::from_pairs(std::move(pairs)) == make_map("a", 3, "b", make_list(2)));
+    }
+
+    SECTION("atoms")
+    {
+        auto map = make_map("a", 1);
+        auto pairs = std::vector<std::pair<Atom, Value>>{};
+        pairs.emplace_back(Atom{"b"}, 2);
+        map.set_range(std::move(pairs));
+        REQUIRE(map == make_map("a", 1, "b", 2));
+    }
+
+    SECTION("transform")
+    {
+        const char *const names[]{"a", "b", "a"};
+        int count = 0;
+        const auto map = Map::from_pairs(std::begin(names), std::end(names),
+                                         [&count](const char *name)
+                                         { return std::pair{Atom{name}, Value{++count}}; });
+        REQUIRE(map == make_map("a", 3, "b", 2));
+    }
+}
@@ -0,0 +1,53 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <catch2/catch_test_macros.hpp>
+#include <traeger/value/Value.hpp>
+
+TEST_CASE("Map.update_in")
+{
+    using namespace traeger;
+
+    auto state = make_map("a", make_map("b", make_list(0, 1, 2, 3)),
+                          "c", "unchanged");
+
+    SECTION("get_in")
+    {
+        REQUIRE(*state.get_in(make_list("a", "b", 3)) == Value{3});
+        REQUIRE(*state.get_in(make_list("a", "b", -1)) == Value{3});
+        REQUIRE(*state.get_in(make_list("c")) == Value{"unchanged"});
+        REQUIRE(state.get_in(make_list()) == nullptr);
+        REQUIRE(state.get_in(make_list("a", "x")) == nullptr);
+        REQUIRE(state.get_in(make_list("a", "b", 4)) == nullptr);
+        REQUIRE(state.get_in(make_list("c", 0)) == nullptr);
+    }
+
+    SECTION("set_in")
+    {
+        const auto before = state;
+        REQUIRE(state.set_in(make_list("a", "b", 3), "three"));
+        REQUIRE(*state.get_in(make_list("a", "b", 3)) == Value{"three"});
+        REQUIRE(*before.get_in(make_list("a", "b", 3)) == Value{3});
+
+        REQUIRE(state.set_in(make_list("a", "new"), true));
+        REQUIRE(*state.get_in(make_list("a", "new")) == Value{true});
+        REQUIRE(*state.get_in(make_list("c")) == Value{"unchanged"});
+    }
+
+    SECTION("update_in")
+    {
+        REQUIRE(state.update_in(make_list("a", "b", 2),
+                                [](const Value &value) -> Value
+                                { return value.get_int().value() * 10; }));
+        REQUIRE(*state.get_in(make_list("a", "b")) == Value{make_list(0, 1, 20, 3)});
+    }
+
+    SECTION("invalid path")
+    {
+        const auto before = state;
+        REQUIRE_FALSE(state.set_in(make_list(), 1));
+        REQUIRE_FALSE(state.set_in(make_list("x", "y"), 1));
+        REQUIRE_FALSE(state.set_in(make_list("a", "b", 4), 1));
+        REQUIRE_FALSE(state.set_in(make_list("a", 0), 1));
+        REQUIRE(state == before);
+    }
+}
@@ -0,0 +1,37 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <catch2/catch_test_macros.hpp>
+#include <traeger/value/Value.hpp>
+
+TEST_CASE("MapView.find")
+{
+    using namespace traeger;
+
+    const auto value = Value{make_map("a", 1, "b", make_map("c", 2))};
+    const auto view = value.get_map_view();
+    REQUIRE(view);
+    const auto list = Value{make_list()};
+    REQUIRE_FALSE(list.get_map_view());
+
+    REQUIRE(view->size() == 2);
+    REQUIRE_FALSE(view->empty());
+    REQUIRE(view->contains("a"));
+    REQUIRE_FALSE(view->contains("c"));
+    REQUIRE(*view->find("a") == Value{1});
+    REQUIRE(*view->find(Atom{"b"}) == Value{make_map("c", 2)});
+    REQUIRE(view->find("c") == nullptr);
+
+    // Nested containers are traversed without copies.
+    const auto nested = view->find("b")->get_map_view();
+    REQUIRE(nested);
+    REQUIRE(*nested->find("c") == Value{2});
+
+    auto count = 0;
+    for (const auto &[key, element] : view.value())
+    {
+        REQUIRE(element == *view->find(key));
+        ++count;
+    }
+    REQUIRE(count == 2);
+    REQUIRE(view->map() == make_map("a", 1, "b", make_map("c", 2)));
+}
@@ -0,0 +1,113 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <catch2/catch_test_macros.hpp>
+#include <stdexcept>
+#include <atomic>
+#include <traeger/actor/Scheduler.hpp>
+#include <traeger/actor/Promise.hpp>
+#include <traeger/actor/Parallel.hpp>
+
+TEST_CASE("parallel.map")
+{
+    using namespace traeger;
+
+    const auto scheduler = Scheduler{Threads{8}};
+    auto list = List{};
+    auto doubled = List{};
+    auto even = List{};
+    for (Int n = 0; n < 10000; ++n)
+    {
+        list.append(n);
+        doubled.append(2 * n);
+        if (n % 2 == 0)
+        {
+            even.append(n);
+        }
+    }
+
+    SECTION("map")
+    {
+        const auto promise = parallel::map(scheduler, list,
+                                           [](const Value &value) -> Value
+                                           { return 2 * value.get_int().value(); });
+        REQUIRE(promise.wait() == Result{Value{doubled}});
+    }
+
+    SECTION("filter")
+    {
+        const auto promise = parallel::filter(scheduler, list,
+                                              [](const Value &value)
+                                              { return value.get_int().value() % 2 == 0; });
+        REQUIRE(promise.wait() == Result{Value{even}});
+    }
+
+    SECTION("reduce")
+    {
+        const auto promise = parallel::reduce(scheduler, list, Value{Int{1}},
+                                              [](const Value &left, const Value &right) -> Value
+                                              { return left.get_int().value() + right.get_int().value(); });
+        REQUIRE(promise.wait() == Result{Value{Int{49995001}}});
+        REQUIRE(parallel::reduce(scheduler, List{}, Value{"empty"}, {}).wait() ==
+                Result{Value{"empty"}});
+    }
+
+    SECTION("sort")
+    {
+        auto reversed = List{};
+        auto sorted = List{};
+        for (Int n = 9999; n >= 0; --n)
+        {
+            reversed.append(make_list(n / 2, n));
+        }
+        // Equal keys keep their order, the greater value comes first.
+        for (Int n = 0; n < 10000; n += 2)
+        {
+            sorted.append(make_list(n / 2, n + 1), make_list(n / 2, n));
+        }
+        const auto promise = parallel::sort(scheduler, reversed,
+                                            [](const Value &left, const Value &right)
+                                            {
+                                                return left.get_list()->find(0)->get_int().value() <
+                                                       right.get_list()->find(0)->get_int().value();
+                                            });
+        REQUIRE(promise.wait() == Result{Value{sorted}});
+    }
+
+    SECTION("for_each")
+    {
+        auto sum = std::atomic<Int>{0};
+        const auto promise = parallel::for_each(scheduler, list,
+                                                [&sum](const Value &value)
+                                                { sum += value.get_int().value(); });
+        REQUIRE(promise.wait() == Result{Value{}});
+        REQUIRE(sum == 49995000);
+    }
+
+    SECTION("error")
+    {
+        const auto promise = parallel::map(scheduler, list,
+                                           [](const Value &value) -> Value
+                                           {
+                                               if (value.get_int().value() == 5000)
+                                               {
+                                                   throw std::runtime_error{"failed"};
+                                               }
+                                               return value;
+                                           });
+        REQUIRE(promise.wait() == Result{Error{"failed"}});
+    }
+
+    SECTION("unknown error")
+    {
+        const auto promise = parallel::map(scheduler, list,
+                                           [](const Value &value) -> Value
+                                           {
+                                               if (value.get_int().value() == 5000)
+                                               {
+                                                   throw 5000;
+                                               }
+                                               return value;
+                                           });
+        REQUIRE(promise.wait() == Result{Error{"unknown exception"}});
+    }
+}
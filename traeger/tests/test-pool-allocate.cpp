@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <set>
+#include <thread>
+#include <vector>
+#include <traeger/actor/Pool.hpp>
+
+TEST_CASE("Pool.allocate")
+{
+    using namespace traeger;
+
+    SECTION("reused")
+    {
+        auto *first = Pool::allocate(100);
+        const auto cached = Pool::cached(100);
+        Pool::deallocate(first, 100);
+        REQUIRE(Pool::cached(100) == cached + 1);
+
+        auto *second = Pool::allocate(120);
+        REQUIRE(second == first);
+        REQUIRE(Pool::cached(100) == cached);
+        Pool::deallocate(second, 120);
+    }
+
+    SECTION("large")
+    {
+        auto *pointer = Pool::allocate(8192);
+        REQUIRE(pointer != nullptr);
+        REQUIRE(Pool::cached(8192) == 0);
+        Pool::deallocate(pointer, 8192);
+        REQUIRE(Pool::cached(8192) == 0);
+    }
+
+    SECTION("make_pooled")
+    {
+        auto weak = std::weak_ptr<int>{};
+        {
+            const auto shared = make_pooled<int>(123);
+            weak = shared;
+            REQUIRE(*shared == 123);
+        }
+        REQUIRE(weak.expired());
+    }
+
+    SECTION("other thread")
+    {
+        auto allocated = std::vector<void *>{};
+        for (int n = 0; n < 1024; ++n)
+        {
+            allocated.push_back(Pool::allocate(500));
+        }
+        std::thread{[&allocated]
+                    {
+                        for (auto *pointer : allocated)
+                        {
+                            Pool::deallocate(pointer, 500);
+                        }
+                    }}
+            .join();
+
+        // The blocks freed by the other thread come back in batches.
+        const auto freed = std::set<void *>{allocated.begin(), allocated.end()};
+        auto reused = 0;
+        for (auto &pointer : allocated)
+        {
+            pointer = Pool::allocate(500);
+            reused += static_cast<int>(freed.count(pointer));
+        }
+        REQUIRE(reused >= 512);
+        for (auto *pointer : allocated)
+        {
+            Pool::deallocate(pointer, 500);
+        }
+    }
+}
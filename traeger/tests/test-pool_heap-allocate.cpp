@@ -0,0 +1,59 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <catch2/catch_test_macros.hpp>
+#include <set>
+#include <thread>
+#include <vector>
+#include <traeger/value/Memory_impl.hpp>
+
+TEST_CASE("pool_heap.allocate")
+{
+    using namespace traeger;
+
+    SECTION("reused")
+    {
+        auto *first = pool_heap::allocate(300);
+        pool_heap::deallocate(300, first);
+        auto *second = pool_heap::allocate(320);
+        REQUIRE(second == first);
+        pool_heap::deallocate(320, second);
+    }
+
+    SECTION("large")
+    {
+        auto *node = pool_heap::allocate(1 << 20);
+        REQUIRE(node != nullptr);
+        pool_heap::deallocate(1 << 20, node);
+    }
+
+    SECTION("other thread")
+    {
+        auto allocated = std::vector<void *>{};
+        for (int n = 0; n < 4096; ++n)
+        {
+            allocated.push_back(pool_heap::allocate(4000));
+        }
+        std::thread{[&allocated]
+                    {
+                        for (auto *node : allocated)
+                        {
+                            pool_heap::deallocate(4000, node);
+                        }
+                    }}
+            .join();
+
+        // The nodes released by the other thread come back in magazines.
+        const auto released = std::set<void *>{allocated.begin(), allocated.end()};
+        auto reused = 0;
+        for (auto &node : allocated)
+        {
+            node = pool_heap::allocate(4000);
+            reused += static_cast<int>(released.count(node));
+        }
+        REQUIRE(reused >= 2048);
+        for (auto *node : allocated)
+        {
+            pool_heap::deallocate(4000, node);
+        }
+    }
+}
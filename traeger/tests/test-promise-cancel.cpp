@@ -0,0 +1,128 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <future>
+#include <traeger/actor/Scheduler.hpp>
+#include <traeger/actor/Promise.hpp>
+#include <traeger/actor/StatelessActor.hpp>
+
+TEST_CASE("Promise.cancel")
+{
+    using namespace traeger;
+
+    const auto scheduler = Scheduler{Threads{8}};
+    const auto promise = Promise{scheduler};
+
+    SECTION("downstream")
+    {
+        auto called = std::atomic<bool>{false};
+        const auto chained = promise.then(
+            [&called](const Value &value) -> Result
+            {
+                called = true;
+                return Result{value};
+            });
+
+        REQUIRE(promise.cancel());
+        REQUIRE_FALSE(promise.cancel());
+        REQUIRE(promise.is_cancelled());
+        REQUIRE(chained.wait() == Result{Error::cancelled()});
+        REQUIRE(chained.is_cancelled());
+        REQUIRE_FALSE(called);
+    }
+
+    SECTION("upstream")
+    {
+        const auto chained = promise.then(
+            [](const Value &value) -> Result
+            {
+                return Result{value};
+            });
+
+        REQUIRE(chained.cancel());
+        REQUIRE(promise.is_cancelled());
+        REQUIRE_FALSE(promise.set_result(Result{Value{123}}));
+    }
+
+    SECTION("fan out")
+    {
+        const auto cancelled = promise.then(
+            [](const Value &value) -> Result
+            {
+                return Result{value};
+            });
+        const auto resolved = promise.then(
+            [](const Value &value) -> Result
+            {
+                return Result{value};
+            });
+
+        REQUIRE(cancelled.cancel());
+        REQUIRE_FALSE(promise.is_cancelled());
+        REQUIRE(promise.set_result(Result{Value{123}}));
+        REQUIRE(resolved.wait() == Result{Value{123}});
+        REQUIRE(cancelled.wait() == Result{Error::cancelled()});
+    }
+
+    SECTION("same text")
+    {
+        const auto chained = promise.then(
+            [](const Value &value) -> Result
+            {
+                return Result{value};
+            });
+
+        REQUIRE(promise.set_result(Result{Error{"cancelled"}}));
+        REQUIRE_FALSE(promise.is_cancelled());
+        REQUIRE(chained.wait() == Result{Error{"cancelled"}});
+        REQUIRE_FALSE(chained.is_cancelled());
+    }
+
+    SECTION("set_result_from_promise")
+    {
+        const auto other = Promise{scheduler};
+        other.set_result_from_promise(promise);
+
+        REQUIRE(other.cancel());
+        REQUIRE(promise.is_cancelled());
+    }
+
+    SECTION("resolved")
+    {
+        promise.set_result(Result{Value{123}});
+        REQUIRE_FALSE(promise.cancel());
+        REQUIRE_FALSE(promise.is_cancelled());
+    }
+
+    SECTION("queued task")
+    {
+        const auto actor = StatelessActor{};
+        auto release = std::promise<void>{};
+        auto released = release.get_future().share();
+        auto count = std::atomic<int>{0};
+        actor.define_writer(
+            "block",
+            [released](const List &) -> Result
+            {
+                released.wait();
+                return Result{Value{nullptr}};
+            });
+        actor.define_writer(
+            "count",
+            [&count](const List &) -> Result
+            {
+                return Result{Value{++count}};
+            });
+
+        const auto mailbox = actor.mailbox();
+        const auto blocked = mailbox.send(scheduler, "block", List{});
+        const auto skipped = mailbox.send(scheduler, "count", List{});
+        REQUIRE(skipped.cancel());
+        release.set_value();
+
+        REQUIRE(mailbox.send(scheduler, "count", List{}).wait() == Result{Value{1}});
+        REQUIRE(blocked.wait() == Result{Value{nullptr}});
+        REQUIRE(count == 1);
+    }
+}
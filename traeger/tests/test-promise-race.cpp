@@ -0,0 +1,58 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <catch2/catch_test_macros.hpp>
+#include <traeger/actor/Scheduler.hpp>
+#include <traeger/actor/Promise.hpp>
+
+TEST_CASE("Promise.race")
+{
+    using namespace traeger;
+
+    const auto scheduler = Scheduler{Threads{8}};
+    const auto promises = std::vector<Promise>{
+        Promise{scheduler},
+        Promise{scheduler},
+    };
+
+    SECTION("value")
+    {
+        const auto promise = Promise::race(scheduler, promises);
+        promises[1].set_result(Result{Value{2}});
+        promises[0].set_result(Result{Error{"failed"}});
+
+        REQUIRE(promise.result() == Result{Value{2}});
+    }
+
+    SECTION("error")
+    {
+        const auto promise = Promise::race(scheduler, promises);
+        promises[0].set_result(Result{Error{"failed"}});
+        promises[1].set_result(Result{Value{2}});
+
+        REQUIRE(promise.result() == Result{Error{"failed"}});
+    }
+
+    SECTION("empty")
+    {
+        const auto promise = Promise::race(scheduler, {});
+        REQUIRE(promise.result().type() == Result::Type::Error);
+    }
+
+    SECTION("losers are cancelled")
+    {
+        const auto promise = Promise::race(scheduler, promises);
+        promises[1].set_result(Result{Value{2}});
+
+        REQUIRE(promise.result() == Result{Value{2}});
+        REQUIRE(promises[0].is_cancelled());
+        REQUIRE_FALSE(promises[1].is_cancelled());
+    }
+
+    SECTION("cancel")
+    {
+        const auto promise = Promise::race(scheduler, promises);
+        REQUIRE(promise.cancel());
+        REQUIRE(promises[0].is_cancelled());
+        REQUIRE(promises[1].is_cancelled());
+    }
+}
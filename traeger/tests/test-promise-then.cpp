@@ -3,6 +3,7 @@
 #include <catch2/catch_test_macros.hpp>
 #include <future>
 #include <chrono>
+#include <thread>
 #include <traeger/actor/Scheduler.hpp>
 #include <traeger/actor/Promise.hpp>
 
@@ -65,4 +66,50 @@ TEST_CASE("Promise.then")
         REQUIRE(first_promise.get_future().get() == Value{1000});
         REQUIRE(second_promise.get_future().get() == Value{2000});
     }
-}
\ No newline at end of file
+
+    SECTION("inline")
+    {
+        auto first_thread = std::thread::id{};
+        auto second_thread = std::promise<std::thread::id>{};
+        precedent_promise
+            .then(
+                [&first_thread](const Value &value) -> Result
+                {
+                    first_thread = std::this_thread::get_id();
+                    return Result{value};
+                })
+            .then(
+                [&second_thread](const Value &) -> Result
+                {
+                    second_thread.set_value(std::this_thread::get_id());
+                    return Result{};
+                },
+                Promise::Execution::Inline);
+
+        precedent_promise.set_result(Result{Value{1000}});
+        REQUIRE(second_thread.get_future().get() == first_thread);
+    }
+
+    SECTION("scheduler")
+    {
+        const auto other_scheduler = Scheduler{Threads{1}};
+        precedent_promise
+            .then(
+                [&first_promise, other_scheduler](const Value &value) -> Result
+                {
+                    first_promise.set_value(Value{other_scheduler.is_worker_thread()});
+                    return Result{value};
+                },
+                other_scheduler)
+            .then(
+                [&second_promise](const Value &value) -> Result
+                {
+                    second_promise.set_value(value);
+                    return Result{};
+                });
+
+        precedent_promise.set_result(Result{Value{1000}});
+        REQUIRE(first_promise.get_future().get() == Value{true});
+        REQUIRE(second_promise.get_future().get() == Value{1000});
+    }
+}
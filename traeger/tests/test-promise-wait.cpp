@@ -0,0 +1,40 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <catch2/catch_test_macros.hpp>
+#include <traeger/actor/Scheduler.hpp>
+#include <traeger/actor/Promise.hpp>
+
+TEST_CASE("Promise.wait")
+{
+    using namespace traeger;
+
+    const auto scheduler = Scheduler{Threads{8}};
+    const auto promise = Promise{scheduler};
+
+    SECTION("ready")
+    {
+        promise.set_result(Result{Value{123}});
+        REQUIRE(promise.wait() == Result{Value{123}});
+    }
+
+    SECTION("pending")
+    {
+        scheduler.schedule(
+            [promise]
+            {
+                promise.set_result(Result{Value{123}});
+            });
+        REQUIRE(promise.wait() == Result{Value{123}});
+    }
+
+    SECTION("chained")
+    {
+        const auto chained = promise.then(
+            [](const Value &value) -> Result
+            {
+                return Result{Value{value.get<Int>().value() * 2}};
+            });
+        promise.set_result(Result{Value{21}});
+        REQUIRE(chained.wait() == Result{Value{42}});
+    }
+}
@@ -0,0 +1,53 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <traeger/actor/Scheduler.hpp>
+#include <traeger/actor/Promise.hpp>
+
+TEST_CASE("Promise.wait_for")
+{
+    using namespace traeger;
+    using namespace std::chrono_literals;
+
+    const auto scheduler = Scheduler{Threads{8}};
+    const auto promise = Promise{scheduler};
+
+    SECTION("ready")
+    {
+        scheduler.schedule_delayed(
+            10ms,
+            [promise]
+            {
+                promise.set_result(Result{Value{123}});
+            });
+        REQUIRE(promise.wait_for(1s) == Result{Value{123}});
+    }
+
+    SECTION("timeout")
+    {
+        const auto result = promise.wait_for(10ms);
+        REQUIRE(result.type() == Result::Type::Undefined);
+        REQUIRE_FALSE(promise.has_result());
+    }
+
+    SECTION("polling")
+    {
+        auto undefined = 0;
+        for (int n = 0; n < 1000; ++n)
+        {
+            if (promise.wait_for(1us).type() == Result::Type::Undefined)
+            {
+                ++undefined;
+            }
+        }
+        REQUIRE(undefined == 1000);
+        scheduler.schedule_delayed(
+            10ms,
+            [promise]
+            {
+                promise.set_result(Result{Value{123}});
+            });
+        REQUIRE(promise.wait() == Result{Value{123}});
+    }
+}
@@ -0,0 +1,72 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <catch2/catch_test_macros.hpp>
+#include <future>
+#include <chrono>
+#include <traeger/actor/Scheduler.hpp>
+#include <traeger/actor/Promise.hpp>
+
+TEST_CASE("Promise.when_all")
+{
+    using namespace traeger;
+    using namespace std::chrono_literals;
+
+    const auto scheduler = Scheduler{Threads{8}};
+    const auto promises = std::vector<Promise>{
+        Promise{scheduler},
+        Promise{scheduler},
+        Promise{scheduler},
+    };
+
+    SECTION("values")
+    {
+        auto promise_value = std::promise<Value>{};
+        Promise::when_all(scheduler, promises)
+            .then(
+                [&promise_value](const Value &value) -> Result
+                {
+                    promise_value.set_value(value);
+                    return Result{};
+                });
+
+        scheduler.schedule_delayed(10ms, [promise = promises[0]]
+                                   { promise.set_result(Result{Value{1}}); });
+        promises[2].set_result(Result{Value{3}});
+        promises[1].set_result(Result{Value{2}});
+
+        REQUIRE(promise_value.get_future().get() == make_list(1, 2, 3));
+    }
+
+    SECTION("error")
+    {
+        auto promise_error = std::promise<Error>{};
+        Promise::when_all(scheduler, promises)
+            .fail(
+                [&promise_error](const Error &error) -> void
+                {
+                    promise_error.set_value(error);
+                });
+
+        promises[0].set_result(Result{Value{1}});
+        promises[1].set_result(Result{Error{"failed"}});
+
+        REQUIRE(promise_error.get_future().get() == Error{"failed"});
+        REQUIRE(promises[2].is_cancelled());
+    }
+
+    SECTION("cancel")
+    {
+        const auto promise = Promise::when_all(scheduler, promises);
+        promises[0].set_result(Result{Value{1}});
+        REQUIRE(promise.cancel());
+        REQUIRE_FALSE(promises[0].is_cancelled());
+        REQUIRE(promises[1].is_cancelled());
+        REQUIRE(promises[2].is_cancelled());
+    }
+
+    SECTION("empty")
+    {
+        const auto promise = Promise::when_all(scheduler, {});
+        REQUIRE(promise.result() == Result{Value{List{}}});
+    }
+}
@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <catch2/catch_test_macros.hpp>
+#include <future>
+#include <traeger/actor/Scheduler.hpp>
+#include <traeger/actor/Promise.hpp>
+
+TEST_CASE("Promise.when_any")
+{
+    using namespace traeger;
+
+    const auto scheduler = Scheduler{Threads{8}};
+    const auto promises = std::vector<Promise>{
+        Promise{scheduler},
+        Promise{scheduler},
+        Promise{scheduler},
+    };
+
+    SECTION("value")
+    {
+        auto promise_value = std::promise<Value>{};
+        Promise::when_any(scheduler, promises)
+            .then(
+                [&promise_value](const Value &value) -> Result
+                {
+                    promise_value.set_value(value);
+                    return Result{};
+                });
+
+        promises[0].set_result(Result{Error{"failed"}});
+        promises[2].set_result(Result{Value{3}});
+        promises[1].set_result(Result{Value{2}});
+
+        REQUIRE(promise_value.get_future().get() == Value{3});
+        REQUIRE(promises[1].is_cancelled());
+    }
+
+    SECTION("errors")
+    {
+        auto promise_error = std::promise<Error>{};
+        Promise::when_any(scheduler, promises)
+            .fail(
+                [&promise_error](const Error &error) -> void
+                {
+                    promise_error.set_value(error);
+                });
+
+        promises[0].set_result(Result{Error{"first"}});
+        promises[1].set_result(Result{Error{"second"}});
+        promises[2].set_result(Result{Error{"third"}});
+
+        REQUIRE(promise_error.get_future().get() == Error{"third"});
+    }
+
+    SECTION("empty")
+    {
+        const auto promise = Promise::when_any(scheduler, {});
+        REQUIRE(promise.result().type() == Result::Type::Error);
+    }
+}
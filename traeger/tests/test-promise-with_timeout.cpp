@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <future>
+#include <traeger/actor/Scheduler.hpp>
+#include <traeger/actor/Promise.hpp>
+
+TEST_CASE("Promise.with_timeout")
+{
+    using namespace traeger;
+    using namespace std::chrono_literals;
+
+    const auto scheduler = Scheduler{Threads{8}};
+    const auto promise = Promise{scheduler};
+
+    SECTION("value")
+    {
+        auto promise_value = std::promise<Value>{};
+        promise
+            .with_timeout(1s)
+            .then(
+                [&promise_value](const Value &value) -> Result
+                {
+                    promise_value.set_value(value);
+                    return Result{};
+                });
+
+        promise.set_result(Result{Value{123}});
+
+        REQUIRE(promise_value.get_future().get() == Value{123});
+    }
+
+    SECTION("timeout")
+    {
+        auto promise_error = std::promise<Error>{};
+        promise
+            .with_timeout(10ms)
+            .fail(
+                [&promise_error](const Error &error) -> void
+                {
+                    promise_error.set_value(error);
+                });
+
+        const auto error = promise_error.get_future().get();
+        REQUIRE(error.is_timeout());
+        REQUIRE(error == Error::timeout());
+        REQUIRE(promise.wait() == Result{Error::cancelled()});
+    }
+
+    SECTION("repeated")
+    {
+        // A chained promise keeps the source from being cancelled.
+        const auto chained = promise.then(
+            [](const Value &value) -> Result
+            {
+                return Result{value};
+            });
+        for (int n = 0; n < 100; ++n)
+        {
+            REQUIRE(promise.with_timeout(1ms).wait() == Result{Error::timeout()});
+        }
+        const auto pending = promise.with_timeout(1s);
+        promise.set_result(Result{Value{123}});
+        REQUIRE(pending.wait() == Result{Value{123}});
+    }
+
+    SECTION("same text")
+    {
+        const auto error = Error{"timeout"};
+        REQUIRE_FALSE(error.is_timeout());
+        REQUIRE(Result{error} != Result{Error::timeout()});
+    }
+
+    SECTION("expiry cancels the source")
+    {
+        auto failed = std::promise<Error>{};
+        promise.fail(
+            [&failed](const Error &error) -> void
+            {
+                failed.set_value(error);
+            });
+        REQUIRE(promise.with_timeout(10ms).wait() == Result{Error::timeout()});
+        REQUIRE(promise.wait() == Result{Error::cancelled()});
+        REQUIRE(promise.is_cancelled());
+        REQUIRE(failed.get_future().get().is_cancelled());
+    }
+
+    SECTION("cancel cancels the source")
+    {
+        const auto timed = promise.with_timeout(1s);
+        REQUIRE(timed.cancel());
+        REQUIRE(promise.wait() == Result{Error::cancelled()});
+    }
+
+    SECTION("other dependents keep the source")
+    {
+        const auto chained = promise.then(
+            [](const Value &value) -> Result
+            {
+                return Result{value};
+            });
+        REQUIRE(promise.with_timeout(1ms).wait() == Result{Error::timeout()});
+        REQUIRE_FALSE(promise.is_cancelled());
+        REQUIRE(promise.set_result(Result{Value{123}}));
+        REQUIRE(chained.wait() == Result{Value{123}});
+    }
+}
@@ -0,0 +1,33 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <catch2/catch_test_macros.hpp>
+#include <future>
+#include <traeger/actor/Scheduler.hpp>
+
+TEST_CASE("Scheduler.is_worker_thread")
+{
+    using namespace traeger;
+
+    const auto scheduler = Scheduler{Threads{2}};
+    const auto other_scheduler = Scheduler{Threads{2}};
+
+    SECTION("caller")
+    {
+        REQUIRE_FALSE(scheduler.is_worker_thread());
+    }
+
+    SECTION("worker")
+    {
+        auto promise = std::promise<std::pair<bool, bool>>{};
+        scheduler.schedule(
+            [&promise, scheduler, other_scheduler]
+            {
+                promise.set_value({scheduler.is_worker_thread(),
+                                   other_scheduler.is_worker_thread()});
+            });
+
+        const auto [is_worker, is_other_worker] = promise.get_future().get();
+        REQUIRE(is_worker);
+        REQUIRE_FALSE(is_other_worker);
+    }
+}
@@ -0,0 +1,46 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <thread>
+#include <traeger/actor/Scheduler.hpp>
+
+TEST_CASE("Scheduler.schedule_timer")
+{
+    using namespace traeger;
+    using namespace std::chrono_literals;
+
+    const auto scheduler = Scheduler{Threads{8}};
+
+    SECTION("fired")
+    {
+        auto promise = std::promise<int>{};
+        const auto timer = scheduler.schedule_timer(
+            10ms,
+            [&promise]
+            {
+                promise.set_value(123);
+            });
+
+        REQUIRE(promise.get_future().get() == 123);
+        REQUIRE_FALSE(timer.cancel());
+    }
+
+    SECTION("cancelled")
+    {
+        auto fired = std::atomic<bool>{false};
+        const auto timer = scheduler.schedule_timer(
+            10ms,
+            [&fired]
+            {
+                fired = true;
+            });
+
+        REQUIRE(timer.cancel());
+        REQUIRE_FALSE(timer.cancel());
+        std::this_thread::sleep_for(30ms);
+        REQUIRE_FALSE(fired);
+    }
+}
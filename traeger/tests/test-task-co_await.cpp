@@ -0,0 +1,95 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <catch2/catch_test_macros.hpp>
+#include <stdexcept>
+#include <vector>
+#include <traeger/actor/Coroutine.hpp>
+#include <traeger/actor/StatelessActor.hpp>
+
+namespace
+{
+    using namespace traeger;
+
+    auto add_twice(const Scheduler &scheduler,
+                   const Mailbox &mailbox,
+                   const String &method,
+                   Int first,
+                   Int second) -> Task
+    {
+        const auto sum = co_await mailbox.send(scheduler, method, make_list(first, second));
+        if (const auto *error = sum.error(); error)
+        {
+            co_return Error{*error};
+        }
+        co_return co_await mailbox.send(scheduler, method, make_list(*sum.value(), *sum.value()));
+    }
+
+    auto forward(const Scheduler &,
+                 const Promise &promise) -> Task
+    {
+        co_return co_await promise;
+    }
+
+    auto fail(const Scheduler &) -> Task
+    {
+        throw std::runtime_error("failed");
+        co_return nullptr;
+    }
+}
+
+TEST_CASE("Task.co_await")
+{
+    using namespace traeger;
+
+    const auto scheduler = Scheduler{Threads{8}};
+    const auto actor = StatelessActor{};
+    actor.define_reader(
+        "add",
+        [](const List &arguments) -> Result
+        {
+            const auto [first, second] = arguments.get_tuple<Int, Int>();
+            return Result{Value{first + second}};
+        });
+    const auto mailbox = actor.mailbox();
+
+    SECTION("value")
+    {
+        REQUIRE(add_twice(scheduler, mailbox, "add", 1, 2).wait() == Result{Value{6}});
+    }
+
+    SECTION("error")
+    {
+        REQUIRE(add_twice(scheduler, mailbox, "sub", 1, 2).wait() ==
+                Result{Error{"no such actor method sub"}});
+    }
+
+    SECTION("exception")
+    {
+        REQUIRE(fail(scheduler).wait() == Result{Error{"failed"}});
+    }
+
+    SECTION("racing")
+    {
+        // The result is set while the coroutine may be suspending.
+        auto tasks = std::vector<Promise>{};
+        for (int n = 0; n < 1000; ++n)
+        {
+            const auto promise = Promise{scheduler};
+            scheduler.schedule(
+                [promise, n]
+                {
+                    promise.set_result(Result{Value{n}});
+                });
+            tasks.push_back(forward(scheduler, promise));
+        }
+        auto resolved = 0;
+        for (int n = 0; n < 1000; ++n)
+        {
+            if (tasks[n].wait() == Result{Value{n}})
+            {
+                ++resolved;
+            }
+        }
+        REQUIRE(resolved == 1000);
+    }
+}
@@ -0,0 +1,115 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <catch2/catch_test_macros.hpp>
+#include <future>
+#include <stdexcept>
+#include <traeger/actor/Actor.hpp>
+
+namespace
+{
+    using namespace traeger;
+
+    struct Account
+    {
+        auto deposit(Float amount) -> Float
+        {
+            if (amount <= 0.0)
+            {
+                throw std::runtime_error("invalid amount");
+            }
+            funds_ += amount;
+            return funds_;
+        }
+
+        auto rename(const String &name) noexcept -> void
+        {
+            name_ = name;
+        }
+
+        auto balance() const noexcept -> Float
+        {
+            return funds_;
+        }
+
+        auto name() const -> String
+        {
+            return name_;
+        }
+
+    private:
+        Float funds_ = 0.0;
+        String name_;
+    };
+}
+
+TEST_CASE("TypedMailbox.call")
+{
+    using namespace traeger;
+
+    const auto scheduler = Scheduler{Threads{8}};
+    const auto actor = make_actor<Account>();
+    actor.define("deposit", &Account::deposit);
+    actor.define("balance", &Account::balance);
+
+    const auto typed_mailbox = actor.typed_mailbox();
+
+    SECTION("writer")
+    {
+        auto promise_value = std::promise<Value>{};
+        typed_mailbox
+            .call(scheduler, &Account::deposit, 100)
+            .then(
+                [&promise_value](const Value &value) -> void
+                {
+                    promise_value.set_value(value);
+                });
+
+        REQUIRE(promise_value.get_future().get() == 100.0);
+    }
+
+    SECTION("reader")
+    {
+        auto promise_value = std::promise<Value>{};
+        typed_mailbox.call(scheduler, &Account::rename, "savings");
+        typed_mailbox
+            .call(scheduler, &Account::name)
+            .then(
+                [&promise_value](const Value &value) -> void
+                {
+                    promise_value.set_value(value);
+                });
+
+        REQUIRE(promise_value.get_future().get() == "savings");
+    }
+
+    SECTION("shared with mailbox")
+    {
+        auto promise_value = std::promise<Value>{};
+        const auto mailbox = actor.mailbox();
+        mailbox.send(scheduler, "deposit", 30.0);
+        typed_mailbox.call(scheduler, &Account::deposit, 12.0);
+        mailbox
+            .send(scheduler, "balance")
+            .then(
+                [&promise_value](const Value &value) -> void
+                {
+                    promise_value.set_value(value);
+                });
+
+        REQUIRE(promise_value.get_future().get() == 42.0);
+    }
+
+    SECTION("error")
+    {
+        auto promise_error = std::promise<Error>{};
+        typed_mailbox
+            .call(scheduler, &Account::deposit, -1.0)
+            .fail(
+                [&promise_error](const Error &error) -> void
+                {
+                    promise_error.set_value(error);
+                });
+
+        REQUIRE(promise_error.get_future().get() == Error{"invalid amount"});
+    }
+}
@@ -0,0 +1,94 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+#include <traeger/value/Diff.hpp>
+#include <traeger/value/Value.hpp>
+
+TEST_CASE("Value.diff")
+{
+    using namespace traeger;
+
+    SECTION("unchanged")
+    {
+        const auto value = Value{make_map("a", 1, "b", make_list(1, 2))};
+        REQUIRE(diff(value, value) == Value{make_map()});
+        REQUIRE(diff(Value{1}, Value{1}) == Value{make_map()});
+    }
+
+    SECTION("scalar")
+    {
+        const auto delta = diff(Value{1}, Value{"one"});
+        REQUIRE(delta == Value{make_map("value", "one")});
+        REQUIRE(patch(Value{1}, delta).first == Value{"one"});
+    }
+
+    SECTION("map")
+    {
+        auto state = Map{};
+        for (int n = 0; n < 1000; ++n)
+        {
+            state.set("key" + std::to_string(n), n);
+        }
+        auto next = state;
+        next.set("key1", "changed");
+        next.set("added", true);
+        next.erase("key2");
+
+        const auto delta = diff(state, next);
+        REQUIRE(delta == Value{make_map("erase", make_list("key2"),
+                                        "items", make_map("key1", make_map("value", "changed"),
+                                                          "added", make_map("value", true)))});
+        REQUIRE(patch(state, delta).first == Value{next});
+    }
+
+    SECTION("nested")
+    {
+        const auto old_value = Value{make_map("name", "traeger",
+                                              "items", make_list(make_map("id", 1), make_map("id", 2)))};
+        const auto new_value = Value{make_map("name", "traeger",
+                                              "items", make_list(make_map("id", 1), make_map("id", 3), 4))};
+        const auto delta = diff(old_value, new_value);
+        REQUIRE(delta == Value{make_map("items",
+                                        make_map("items",
+                                                 make_map("size", 3u,
+                                                          "items", make_list(make_list(1, make_map("items", make_map("id", make_map("value", 3)))),
+                                                                             make_list(2, make_map("value", 4))))))});
+        REQUIRE(patch(old_value, delta).first == new_value);
+    }
+
+    SECTION("shrink")
+    {
+        const auto old_value = Value{make_list(1, 2, 3)};
+        const auto new_value = Value{make_list(1)};
+        REQUIRE(patch(old_value, diff(old_value, new_value)).first == new_value);
+    }
+
+    SECTION("invalid")
+    {
+        const auto [result, error] = patch(Value{1}, Value{make_map("size", 2)});
+        REQUIRE_FALSE(result);
+        REQUIRE(error == "invalid delta for type Int");
+        REQUIRE_FALSE(patch(Value{make_list(1)}, Value{1}).first);
+        REQUIRE_FALSE(patch(Value{make_list(1)},
+                            Value{make_map("items", make_list(make_list(5, make_map("value", 0))))})
+                          .first);
+    }
+
+    SECTION("corrupt list")
+    {
+        const auto list = Value{make_list(1, 2)};
+        const auto [result, error] = patch(list, Value{make_map("size", UInt{1} << 40)});
+        REQUIRE_FALSE(result);
+        REQUIRE(error == "invalid size 1099511627776");
+        REQUIRE_FALSE(patch(list, Value{make_map("size", 4u,
+                                                 "items", make_list(make_list(2, make_map("value", 3))))})
+                          .first);
+        REQUIRE(patch(list, Value{make_map("size", 3u,
+                                           "items", make_list(make_list(2, make_map("value", 3))))})
+                    .first == Value{make_list(1, 2, 3)});
+        REQUIRE_FALSE(patch(list, Value{make_map("items", make_list(make_list(-1, make_map("value", 0))))}).first);
+        REQUIRE_FALSE(patch(list, Value{make_map("items", make_list(make_list(Int{1} << 32, make_map("value", 0))))}).first);
+    }
+}
@@ -87,6 +87,22 @@ TEST_CASE("Value.get")
         String str = "ABCDEF";
         value = str;
         REQUIRE(*value.get_string() == str);
+
+        SECTION("longer than the inline capacity")
+        {
+            const auto long_str = String(100, 'x');
+            value = long_str;
+            const auto copy = value;
+            REQUIRE(*value.get_string() == long_str);
+            REQUIRE(value.get_string()->data() == copy.get_string()->data());
+            REQUIRE(copy == Value{long_str});
+        }
+
+        SECTION("empty")
+        {
+            value = "";
+            REQUIRE(value.get_string()->empty());
+        }
     }
 
     SECTION("get_list")
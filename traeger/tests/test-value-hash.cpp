@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <string>
+#include <unordered_set>
+
+#include <catch2/catch_test_macros.hpp>
+#include <traeger/value/Value.hpp>
+
+TEST_CASE("Value.hash")
+{
+    using namespace traeger;
+
+    SECTION("equal values")
+    {
+        const auto long_string = std::string(100, 'x');
+        REQUIRE(Value{long_string}.hash() == Value{long_string}.hash());
+        REQUIRE(Value{"short"}.hash() == Value{"short"}.hash());
+        REQUIRE(Value{make_list(1, "two", 3.0)}.hash() == Value{make_list(1, "two", 3.0)}.hash());
+        REQUIRE(Value{FloatArray{1.0, 2.0}}.hash() == Value{FloatArray{1.0, 2.0}}.hash());
+    }
+
+    SECTION("map order")
+    {
+        auto first = make_map("a", 1, "b", 2, "c", 3);
+        auto second = make_map("c", 3, "b", 2, "a", 1);
+        REQUIRE(first == second);
+        REQUIRE(Value{first}.hash() == Value{second}.hash());
+        second.set("c", 4);
+        REQUIRE(Value{first}.hash() != Value{second}.hash());
+    }
+
+    SECTION("types")
+    {
+        REQUIRE(Value{1}.hash() != Value{1.0}.hash());
+        REQUIRE(Value{make_list()}.hash() != Value{make_map()}.hash());
+    }
+
+    SECTION("shared trees")
+    {
+        auto items = List{};
+        for (int n = 0; n < 1000; ++n)
+        {
+            items.append(make_map("id", n));
+        }
+        const auto value = Value{items};
+        const auto copy = value;
+        REQUIRE(value == copy);
+        REQUIRE(value.hash() == copy.hash());
+
+        auto set = std::unordered_set<Value>{value, copy, Value{items}};
+        REQUIRE(set.size() == 1);
+        set.insert(Value{make_list(1)});
+        REQUIRE(set.size() == 2);
+    }
+
+    SECTION("cached")
+    {
+        auto map = make_map("user", make_map("items", make_list(1, 2, 3), "name", "John"));
+        const auto value = Value{map};
+        const auto hash = value.hash();
+        REQUIRE(Value{map}.hash() == hash);
+
+        REQUIRE(map.set_in(make_list("user", "items", 0), 10));
+        REQUIRE(Value{map}.hash() != hash);
+        REQUIRE(map.set_in(make_list("user", "items", 0), 1));
+        REQUIRE(Value{map}.hash() == hash);
+        REQUIRE(Value{map} == value);
+    }
+}
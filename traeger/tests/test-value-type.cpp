@@ -70,4 +70,22 @@ TEST_CASE("Value.type")
         Value value = Map{};
         REQUIRE(value.type() == Value::Type::Map);
     }
+
+    SECTION("blob")
+    {
+        Value value = Blob{};
+        REQUIRE(value.type() == Value::Type::Blob);
+    }
+
+    SECTION("float array")
+    {
+        Value value = FloatArray{1.0, 2.0};
+        REQUIRE(value.type() == Value::Type::FloatArray);
+    }
+
+    SECTION("int array")
+    {
+        Value value = IntArray{1, 2};
+        REQUIRE(value.type() == Value::Type::IntArray);
+    }
 }
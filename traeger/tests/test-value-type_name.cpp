@@ -77,4 +77,28 @@ TEST_CASE("Value.type_name")
         Value value = Map{};
         REQUIRE(value.type_name() == "Map");
     }
+
+    SECTION("blob")
+    {
+        REQUIRE(Value::type_name(Value::Type::Blob) == "Blob");
+
+        Value value = Blob{};
+        REQUIRE(value.type_name() == "Blob");
+    }
+
+    SECTION("float array")
+    {
+        REQUIRE(Value::type_name(Value::Type::FloatArray) == "FloatArray");
+
+        Value value = FloatArray{};
+        REQUIRE(value.type_name() == "FloatArray");
+    }
+
+    SECTION("int array")
+    {
+        REQUIRE(Value::type_name(Value::Type::IntArray) == "IntArray");
+
+        Value value = IntArray{};
+        REQUIRE(value.type_name() == "IntArray");
+    }
 }
@@ -0,0 +1,254 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <algorithm>
+#include <optional>
+#include <ostream>
+#include <utility>
+
+#include "traeger/value/Array.hpp"
+#include "traeger/value/Array_impl.hpp"
+
+namespace
+{
+    // Independent partial accumulators break the dependency between
+    // consecutive additions, which lets the compiler vectorize the loop.
+    constexpr std::size_t lanes = 8;
+}
+
+namespace traeger
+{
+    template <typename Element>
+    Array<Element>::~Array() noexcept
+    {
+        impl().~impl_type();
+    }
+
+    template <typename Element>
+    Array<Element>::Array() noexcept
+    {
+        new (impl_) impl_type{};
+    }
+
+    template <typename Element>
+    Array<Element>::Array(const Array &other) noexcept
+        : Array()
+    {
+        impl().array = other.impl().array;
+    }
+
+    template <typename Element>
+    Array<Element>::Array(Array &&other) noexcept
+        : Array()
+    {
+        impl().array = std::move(other.impl().array);
+    }
+
+    template <typename Element>
+    Array<Element>::Array(const impl_type &other_impl) noexcept
+        : Array()
+    {
+        impl().array = other_impl.array;
+    }
+
+    template <typename Element>
+    Array<Element>::Array(impl_type &&other_impl) noexcept
+        : Array()
+    {
+        impl().array = std::move(other_impl.array);
+    }
+
+    template <typename Element>
+    Array<Element>::Array(const Element *data,
+                          const std::size_t size) noexcept
+    {
+        new (impl_) impl_type{typename impl_type::persistent_type(data, data + size)};
+    }
+
+    template <typename Element>
+    Array<Element>::Array(std::initializer_list<Element> elements) noexcept
+        : Array(elements.begin(), elements.size())
+    {
+    }
+
+    template <typename Element>
+    auto Array<Element>::operator=(const Array &other) noexcept -> Array &
+    {
+        if (this != &other)
+        {
+            impl().array = other.impl().array;
+        }
+        return *this;
+    }
+
+    template <typename Element>
+    auto Array<Element>::operator=(Array &&other) noexcept -> Array &
+    {
+        impl().array = std::move(other.impl().array);
+        return *this;
+    }
+
+    template <typename Element>
+    auto Array<Element>::operator==(const Array &other) const noexcept -> bool
+    {
+        return size() == other.size() &&
+               std::equal(data(), data() + size(), other.data());
+    }
+
+    template <typename Element>
+    auto Array<Element>::operator!=(const Array &other) const noexcept -> bool
+    {
+        return !(*this == other);
+    }
+
+    template <typename Element>
+    auto Array<Element>::append(const Element element) noexcept -> void
+    {
+        impl().array.push_back(element);
+    }
+
+    template <typename Element>
+    auto Array<Element>::set(const int index,
+                             const Element element) noexcept -> bool
+    {
+        const auto size_ = size();
+        if (const std::size_t position = index < 0 ? index + size_ : index;
+            position < size_)
+        {
+            impl().array.set(position, element);
+            return true;
+        }
+        return false;
+    }
+
+    template <typename Element>
+    auto Array<Element>::get(const int index) const noexcept -> std::optional<Element>
+    {
+        const auto size_ = size();
+        if (const std::size_t position = index < 0 ? index + size_ : index;
+            position < size_)
+        {
+            return data()[position];
+        }
+        return std::nullopt;
+    }
+
+    template <typename Element>
+    auto Array<Element>::data() const noexcept -> const Element *
+    {
+        return impl().array.data();
+    }
+
+    template <typename Element>
+    auto Array<Element>::empty() const noexcept -> bool
+    {
+        return impl().array.empty();
+    }
+
+    template <typename Element>
+    auto Array<Element>::size() const noexcept -> std::size_t
+    {
+        return impl().array.size();
+    }
+
+    template <typename Element>
+    auto Array<Element>::sum() const noexcept -> Element
+    {
+        const auto *elements = data();
+        const auto size_ = size();
+        Element partial[lanes]{};
+        std::size_t n = 0;
+        for (; n + lanes <= size_; n += lanes)
+        {
+            for (std::size_t lane = 0; lane < lanes; ++lane)
+            {
+                partial[lane] += elements[n + lane];
+            }
+        }
+        Element result{};
+        for (; n < size_; ++n)
+        {
+            result += elements[n];
+        }
+        for (const auto value : partial)
+        {
+            result += value;
+        }
+        return result;
+    }
+
+    template <typename Element>
+    auto Array<Element>::min() const noexcept -> std::optional<Element>
+    {
+        if (empty())
+        {
+            return std::nullopt;
+        }
+        return *std::min_element(data(), data() + size());
+    }
+
+    template <typename Element>
+    auto Array<Element>::max() const noexcept -> std::optional<Element>
+    {
+        if (empty())
+        {
+            return std::nullopt;
+        }
+        return *std::max_element(data(), data() + size());
+    }
+
+    template <typename Element>
+    auto Array<Element>::dot(const Array &other) const noexcept -> std::optional<Element>
+    {
+        const auto size_ = size();
+        if (size_ != other.size())
+        {
+            return std::nullopt;
+        }
+        const auto *left = data();
+        const auto *right = other.data();
+        Element partial[lanes]{};
+        std::size_t n = 0;
+        for (; n + lanes <= size_; n += lanes)
+        {
+            for (std::size_t lane = 0; lane < lanes; ++lane)
+            {
+                partial[lane] += left[n + lane] * right[n + lane];
+            }
+        }
+        Element result{};
+        for (; n < size_; ++n)
+        {
+            result += left[n] * right[n];
+        }
+        for (const auto value : partial)
+        {
+            result += value;
+        }
+        return result;
+    }
+
+    template <typename Element>
+    auto operator<<(std::ostream &os,
+                    const Array<Element> &array) noexcept -> std::ostream &
+    {
+        os << '[';
+        const auto *elements = array.data();
+        for (std::size_t n = 0; n < array.size(); ++n)
+        {
+            if (n > 0)
+            {
+                os << ", ";
+            }
+            os << elements[n];
+        }
+        return os << ']';
+    }
+
+    template struct Array<Float>;
+    template struct Array<Int>;
+
+    template auto operator<<(std::ostream &os,
+                             const Array<Float> &array) noexcept -> std::ostream &;
+    template auto operator<<(std::ostream &os,
+                             const Array<Int> &array) noexcept -> std::ostream &;
+}
@@ -0,0 +1,105 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <optional>
+#include <ostream>
+
+#include <traeger/value/Types.hpp>
+
+namespace traeger
+{
+    // A homogeneous sequence of numbers stored in a single contiguous
+    // chunk instead of one boxed value per element.
+    template <typename Element>
+    struct Array
+    {
+        struct impl_type;
+
+        using element_type = Element;
+
+        auto impl() const & noexcept -> const impl_type &
+        {
+            return *reinterpret_cast<const impl_type *>(impl_);
+        }
+
+        auto impl() & noexcept -> impl_type &
+        {
+            return *reinterpret_cast<impl_type *>(impl_);
+        }
+
+        ~Array() noexcept;
+
+        Array() noexcept;
+
+        Array(const Array &other) noexcept;
+
+        Array(Array &&other) noexcept;
+
+        explicit Array(const impl_type &other_impl) noexcept;
+
+        explicit Array(impl_type &&other_impl) noexcept;
+
+        Array(const Element *data,
+              std::size_t size) noexcept;
+
+        Array(std::initializer_list<Element> elements) noexcept;
+
+        auto operator=(const Array &other) noexcept -> Array &;
+
+        auto operator=(Array &&other) noexcept -> Array &;
+
+        auto operator==(const Array &other) const noexcept -> bool;
+
+        auto operator!=(const Array &other) const noexcept -> bool;
+
+        auto append(Element element) noexcept -> void;
+
+        auto set(int index,
+                 Element element) noexcept -> bool;
+
+        auto get(int index) const noexcept -> std::optional<Element>;
+
+        auto data() const noexcept -> const Element *;
+
+        auto empty() const noexcept -> bool;
+
+        auto size() const noexcept -> std::size_t;
+
+        auto sum() const noexcept -> Element;
+
+        auto min() const noexcept -> std::optional<Element>;
+
+        auto max() const noexcept -> std::optional<Element>;
+
+        auto dot(const Array &other) const noexcept -> std::optional<Element>;
+
+        using layout_type = struct
+        {
+            std::uintptr_t _0;
+            std::size_t _1;
+            std::size_t _2;
+        };
+
+    private:
+        std::byte impl_[sizeof(layout_type)]{};
+    };
+
+    using FloatArray = Array<Float>;
+    using IntArray = Array<Int>;
+
+    extern template struct Array<Float>;
+    extern template struct Array<Int>;
+
+    template <typename Element>
+    auto operator<<(std::ostream &os,
+                    const Array<Element> &array) noexcept -> std::ostream &;
+
+    extern template auto operator<<(std::ostream &os,
+                                    const Array<Float> &array) noexcept -> std::ostream &;
+    extern template auto operator<<(std::ostream &os,
+                                    const Array<Int> &array) noexcept -> std::ostream &;
+}
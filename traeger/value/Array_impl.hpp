@@ -0,0 +1,52 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <immer/array.hpp>
+#include <immer/array_transient.hpp>
+
+#include "traeger/value/Array.hpp"
+#include "traeger/value/Memory_impl.hpp"
+
+namespace traeger
+{
+    template <typename Element>
+    struct Array<Element>::impl_type
+    {
+        using persistent_type = immer::array<Element, memory_policy>;
+        using transient_type = immer::array_transient<Element, memory_policy>;
+
+        ~impl_type() noexcept = default;
+
+        impl_type() = default;
+
+        impl_type(const impl_type &other) noexcept = default;
+
+        impl_type(impl_type &&other) noexcept = default;
+
+        explicit impl_type(const persistent_type &persistent) noexcept
+            : array(persistent.transient())
+        {
+        }
+
+        explicit impl_type(persistent_type &&persistent) noexcept
+            : array(std::move(persistent).transient())
+        {
+        }
+
+        auto persistent() const & noexcept -> persistent_type
+        {
+            auto temp = array;
+            return std::move(temp).persistent();
+        }
+
+        auto persistent() && noexcept -> persistent_type
+        {
+            return std::move(array).persistent();
+        }
+
+        static_assert(sizeof(layout_type) == sizeof(transient_type));
+
+        transient_type array;
+    };
+}
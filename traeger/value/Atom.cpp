@@ -0,0 +1,267 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <string_view>
+#include <utility>
+
+#include "traeger/value/Atom.hpp"
+
+namespace
+{
+    constexpr std::size_t max_interned_count = 65536;
+
+    constexpr std::size_t max_interned_size = 64;
+
+    // Twice the entries, so the probe sequences stay short when full.
+    constexpr std::size_t slot_count = 2 * max_interned_count;
+
+    constexpr std::size_t slot_mask = slot_count - 1;
+}
+
+namespace traeger
+{
+    struct Atom::entry_type
+    {
+        std::atomic<std::size_t> count;
+        std::size_t hash;
+        bool interned;
+        String string;
+    };
+
+    // An open addressing table whose slots only go from null to an entry,
+    // and whose entries are never released. Readers probe it without locks
+    // and writers claim an empty slot with a compare and swap. The empty
+    // string is always interned and does not count against the limit.
+    struct Atom::table_type
+    {
+        table_type() noexcept
+            : slots(new std::atomic<entry_type *>[slot_count]{}),
+              empty(new entry_type{{0}, std::hash<std::string_view>{}({}), true, String{}})
+        {
+            slots[empty->hash & slot_mask].store(empty, std::memory_order_relaxed);
+        }
+
+        auto lookup(const std::string_view string,
+                    const std::size_t hash) const noexcept -> entry_type *
+        {
+            for (auto index = hash & slot_mask;; index = (index + 1) & slot_mask)
+            {
+                auto *entry = slots[index].load(std::memory_order_acquire);
+                if (entry == nullptr ||
+                    (entry->hash == hash && entry->string == string))
+                {
+                    return entry;
+                }
+            }
+        }
+
+        // The interned entry of the string, or null once the table is full.
+        auto intern(const std::string_view string,
+                    const std::size_t hash) noexcept -> entry_type *
+        {
+            entry_type *created = nullptr;
+            for (auto index = hash & slot_mask;; index = (index + 1) & slot_mask)
+            {
+                auto &slot = slots[index];
+                auto *entry = slot.load(std::memory_order_acquire);
+                if (entry == nullptr)
+                {
+                    if (created == nullptr)
+                    {
+                        if (full.load(std::memory_order_acquire) ||
+                            size.fetch_add(1, std::memory_order_relaxed) >= max_interned_count)
+                        {
+                            full.store(true, std::memory_order_release);
+                            return nullptr;
+                        }
+                        created = new entry_type{{0}, hash, true, String{string}};
+                    }
+                    if (slot.compare_exchange_strong(entry, created,
+                                                     std::memory_order_acq_rel,
+                                                     std::memory_order_acquire))
+                    {
+                        return created;
+                    }
+                }
+                if (entry->hash == hash && entry->string == string)
+                {
+                    if (created != nullptr)
+                    {
+                        delete created;
+                        size.fetch_sub(1, std::memory_order_relaxed);
+                    }
+                    return entry;
+                }
+            }
+        }
+
+        std::unique_ptr<std::atomic<entry_type *>[]> slots;
+        entry_type *empty;
+        std::atomic<std::size_t> size{0};
+        // Once set it stays set, so a key missing while it is clear was
+        // never made into an atom.
+        std::atomic<bool> full{false};
+    };
+
+    auto Atom::table() noexcept -> table_type &
+    {
+        static auto *const table = new table_type;
+        return *table;
+    }
+
+    auto Atom::make_entry(const std::string_view string) noexcept -> entry_type *
+    {
+        const auto hash = std::hash<std::string_view>{}(string);
+        if (string.size() <= max_interned_size)
+        {
+            if (auto *entry = table().intern(string, hash); entry)
+            {
+                return entry;
+            }
+        }
+        return new entry_type{{1}, hash, false, String{string}};
+    }
+
+    // While the table is not full a short key missing in it was never made
+    // into an atom. Otherwise the key may belong to an atom made out of the
+    // table, which compares by content.
+    auto Atom::find(const std::string_view string) noexcept -> std::optional<Atom>
+    {
+        const auto hash = std::hash<std::string_view>{}(string);
+        if (string.size() <= max_interned_size)
+        {
+            auto &table = Atom::table();
+            if (auto *entry = table.lookup(string, hash); entry)
+            {
+                return Atom{entry};
+            }
+            if (!table.full.load(std::memory_order_acquire))
+            {
+                return std::nullopt;
+            }
+        }
+        return Atom{new entry_type{{1}, hash, false, String{string}}};
+    }
+
+    auto Atom::empty_entry() noexcept -> entry_type *
+    {
+        return table().empty;
+    }
+
+    Atom::~Atom() noexcept
+    {
+        release();
+    }
+
+    Atom::Atom() noexcept
+        : entry_(empty_entry())
+    {
+    }
+
+    Atom::Atom(const String &string) noexcept
+        : entry_(make_entry(string))
+    {
+    }
+
+    Atom::Atom(const std::string_view string) noexcept
+        : entry_(make_entry(string))
+    {
+    }
+
+    Atom::Atom(const char *string) noexcept
+        : entry_(make_entry(string))
+    {
+    }
+
+    Atom::Atom(entry_type *entry) noexcept
+        : entry_(entry)
+    {
+    }
+
+    Atom::Atom(const Atom &other) noexcept
+        : entry_(other.entry_)
+    {
+        acquire();
+    }
+
+    Atom::Atom(Atom &&other) noexcept
+        : entry_(std::exchange(other.entry_, empty_entry()))
+    {
+    }
+
+    auto Atom::operator=(const Atom &other) noexcept -> Atom &
+    {
+        if (entry_ != other.entry_)
+        {
+            other.acquire();
+            release();
+            entry_ = other.entry_;
+        }
+        return *this;
+    }
+
+    auto Atom::operator=(Atom &&other) noexcept -> Atom &
+    {
+        if (this != &other)
+        {
+            std::swap(entry_, other.entry_);
+        }
+        return *this;
+    }
+
+    // Two interned atoms are only equal if they share the entry. A string
+    // interned by another thread as the table filled up may also exist out
+    // of it, so the rest compare by content.
+    auto Atom::operator==(const Atom &other) const noexcept -> bool
+    {
+        if (entry_ == other.entry_)
+        {
+            return true;
+        }
+        if (entry_->interned && other.entry_->interned)
+        {
+            return false;
+        }
+        return entry_->hash == other.entry_->hash &&
+               entry_->string == other.entry_->string;
+    }
+
+    auto Atom::operator!=(const Atom &other) const noexcept -> bool
+    {
+        return !(*this == other);
+    }
+
+    auto Atom::str() const noexcept -> const String &
+    {
+        return entry_->string;
+    }
+
+    auto Atom::hash() const noexcept -> std::size_t
+    {
+        return entry_->hash;
+    }
+
+    auto Atom::interned() const noexcept -> bool
+    {
+        return entry_->interned;
+    }
+
+    auto Atom::acquire() const noexcept -> void
+    {
+        if (!entry_->interned)
+        {
+            entry_->count.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    auto Atom::release() noexcept -> void
+    {
+        if (!entry_->interned &&
+            entry_->count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            delete entry_;
+        }
+    }
+}
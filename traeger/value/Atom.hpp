@@ -0,0 +1,80 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <string_view>
+
+#include <traeger/value/Types.hpp>
+
+namespace traeger
+{
+    // A map key with a cached hash. Short keys are interned in a bounded
+    // global table read without locks, so equal interned atoms share the
+    // same entry and compare by address. Keys that do not fit in the table are reference counted.
+    // Only the constructors intern, lookups go through find.
+    struct Atom
+    {
+        ~Atom() noexcept;
+
+        Atom() noexcept;
+
+        explicit Atom(const String &string) noexcept;
+
+        explicit Atom(std::string_view string) noexcept;
+
+        explicit Atom(const char *string) noexcept;
+
+        Atom(const Atom &other) noexcept;
+
+        Atom(Atom &&other) noexcept;
+
+        auto operator=(const Atom &other) noexcept -> Atom &;
+
+        auto operator=(Atom &&other) noexcept -> Atom &;
+
+        auto operator==(const Atom &other) const noexcept -> bool;
+
+        auto operator!=(const Atom &other) const noexcept -> bool;
+
+        auto str() const noexcept -> const String &;
+
+        auto hash() const noexcept -> std::size_t;
+
+        auto interned() const noexcept -> bool;
+
+        // The atom of an existing key, without adding it to the table. It is
+        // nullopt when the key was never interned, so no map can hold it.
+        static auto find(std::string_view string) noexcept -> std::optional<Atom>;
+
+    private:
+        struct entry_type;
+
+        struct table_type;
+
+        explicit Atom(entry_type *entry) noexcept;
+
+        static auto table() noexcept -> table_type &;
+
+        static auto make_entry(std::string_view string) noexcept -> entry_type *;
+
+        static auto empty_entry() noexcept -> entry_type *;
+
+        auto acquire() const noexcept -> void;
+
+        auto release() noexcept -> void;
+
+        entry_type *entry_;
+    };
+}
+
+template <>
+struct std::hash<traeger::Atom>
+{
+    auto operator()(const traeger::Atom &atom) const noexcept -> std::size_t
+    {
+        return atom.hash();
+    }
+};
@@ -0,0 +1,121 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <cstring>
+#include <iomanip>
+#include <memory>
+#include <ostream>
+#include <utility>
+
+#include "traeger/value/Blob.hpp"
+
+namespace traeger
+{
+    struct Blob::impl_type
+    {
+        ~impl_type() noexcept
+        {
+            if (release)
+            {
+                release();
+            }
+        }
+
+        impl_type(const char *data,
+                  std::size_t size,
+                  Release &&release) noexcept
+            : data(data),
+              size(size),
+              release(std::move(release))
+        {
+        }
+
+        explicit impl_type(std::string_view bytes) noexcept
+            : owned(new char[bytes.size()]),
+              data(owned.get()),
+              size(bytes.size())
+        {
+            std::memcpy(owned.get(), bytes.data(), bytes.size());
+        }
+
+        std::unique_ptr<char[]> owned;
+        const char *data;
+        std::size_t size;
+        Release release;
+    };
+
+    Blob::~Blob() noexcept = default;
+
+    Blob::Blob() noexcept = default;
+
+    Blob::Blob(const Blob &other) noexcept = default;
+
+    Blob::Blob(Blob &&other) noexcept = default;
+
+    Blob::Blob(const std::string_view bytes) noexcept
+        : impl_(bytes.empty() ? nullptr : std::make_shared<const impl_type>(bytes))
+    {
+    }
+
+    Blob::Blob(const char *data,
+               const std::size_t size) noexcept
+        : Blob(std::string_view{data, size})
+    {
+    }
+
+    Blob::Blob(const char *data,
+               const std::size_t size,
+               Release &&release) noexcept
+        : impl_(std::make_shared<const impl_type>(data, size, std::move(release)))
+    {
+    }
+
+    auto Blob::operator=(const Blob &other) noexcept -> Blob & = default;
+
+    auto Blob::operator=(Blob &&other) noexcept -> Blob & = default;
+
+    auto Blob::operator==(const Blob &other) const noexcept -> bool
+    {
+        return impl_ == other.impl_ || view() == other.view();
+    }
+
+    auto Blob::operator!=(const Blob &other) const noexcept -> bool
+    {
+        return !(*this == other);
+    }
+
+    auto Blob::data() const noexcept -> const char *
+    {
+        return impl_ ? impl_->data : nullptr;
+    }
+
+    auto Blob::size() const noexcept -> std::size_t
+    {
+        return impl_ ? impl_->size : 0;
+    }
+
+    auto Blob::empty() const noexcept -> bool
+    {
+        return size() == 0;
+    }
+
+    auto Blob::view() const noexcept -> std::string_view
+    {
+        return impl_ ? std::string_view{impl_->data, impl_->size} : std::string_view{};
+    }
+
+    auto operator<<(std::ostream &os,
+                    const Blob &blob) noexcept -> std::ostream &
+    {
+        os << "b\"";
+        const auto flags = os.flags();
+        const auto fill = os.fill('0');
+        for (const auto byte : blob.view())
+        {
+            os << "\\x" << std::hex << std::setw(2)
+               << static_cast<int>(static_cast<unsigned char>(byte));
+        }
+        os.fill(fill);
+        os.flags(flags);
+        return os << '"';
+    }
+}
@@ -0,0 +1,63 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <ostream>
+#include <string_view>
+
+#include <traeger/value/Types.hpp>
+
+namespace traeger
+{
+    // An immutable and reference counted sequence of bytes. The bytes are
+    // either owned by the blob or borrowed from foreign memory, in which
+    // case the release callback runs once the last copy is destroyed.
+    struct Blob
+    {
+        using Release = std::function<void()>;
+
+        ~Blob() noexcept;
+
+        Blob() noexcept;
+
+        Blob(const Blob &other) noexcept;
+
+        Blob(Blob &&other) noexcept;
+
+        explicit Blob(std::string_view bytes) noexcept;
+
+        Blob(const char *data,
+             std::size_t size) noexcept;
+
+        Blob(const char *data,
+             std::size_t size,
+             Release &&release) noexcept;
+
+        auto operator=(const Blob &other) noexcept -> Blob &;
+
+        auto operator=(Blob &&other) noexcept -> Blob &;
+
+        auto operator==(const Blob &other) const noexcept -> bool;
+
+        auto operator!=(const Blob &other) const noexcept -> bool;
+
+        auto data() const noexcept -> const char *;
+
+        auto size() const noexcept -> std::size_t;
+
+        auto empty() const noexcept -> bool;
+
+        auto view() const noexcept -> std::string_view;
+
+    private:
+        struct impl_type;
+
+        std::shared_ptr<const impl_type> impl_;
+    };
+
+    auto operator<<(std::ostream &os,
+                    const Blob &blob) noexcept -> std::ostream &;
+}
@@ -0,0 +1,149 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <traeger/value/Types.hpp>
+#include <traeger/value/Value.hpp>
+
+namespace traeger
+{
+    template <typename Object, typename Member>
+    struct Field
+    {
+        const char *name;
+        Member Object::*member;
+    };
+
+    template <typename Object, typename Member>
+    constexpr auto field(const char *name,
+                         Member Object::*member) noexcept -> Field<Object, Member>
+    {
+        return Field<Object, Member>{name, member};
+    }
+
+    // Objects declared with TRAEGER_FIELDS are converted to and from a Map
+    // whose keys are the names of the fields.
+    template <typename Object>
+    struct Convert<Object, std::void_t<decltype(traeger_fields(std::declval<const Object *>()))>>
+    {
+        static constexpr auto type() noexcept -> Value::Type
+        {
+            return Value::Type::Map;
+        }
+
+        static auto to_value(const Object &object) noexcept -> Value
+        {
+            Map map;
+            std::apply(
+                [&map, &object](const auto &...fields)
+                { (map.set(fields.name, Value{object.*fields.member}), ...); },
+                traeger_fields(&object));
+            return Value{std::move(map)};
+        }
+
+        static auto from_value(const Value &value) noexcept -> std::optional<Object>
+        {
+            const auto map = value.get_map();
+            if (!map)
+            {
+                return std::nullopt;
+            }
+            auto object = Object{};
+            const auto ok = std::apply(
+                [&map, &object](const auto &...fields)
+                { return (get_field(*map, object, fields) && ...); },
+                traeger_fields(&object));
+            if (!ok)
+            {
+                return std::nullopt;
+            }
+            return object;
+        }
+
+    private:
+        template <typename Member>
+        static auto get_field(const Map &map,
+                              Object &object,
+                              const Field<Object, Member> &field) noexcept -> bool
+        {
+            const auto *ptr_value = map.find(field.name);
+            if (!ptr_value)
+            {
+                return false;
+            }
+            if constexpr (std::is_same_v<Member, Value>)
+            {
+                object.*field.member = *ptr_value;
+            }
+            else
+            {
+                auto optional = ptr_value->template get<Member>();
+                if (!optional)
+                {
+                    return false;
+                }
+                object.*field.member = std::move(optional).value();
+            }
+            return true;
+        }
+    };
+}
+
+#define TRAEGER_FIELD(Type, name) ::traeger::field(#name, &Type::name)
+
+#define TRAEGER_FIELDS_1(Type, _1) TRAEGER_FIELD(Type, _1)
+#define TRAEGER_FIELDS_2(Type, _1, _2) TRAEGER_FIELD(Type, _1), TRAEGER_FIELD(Type, _2)
+#define TRAEGER_FIELDS_3(Type, _1, _2, _3) TRAEGER_FIELD(Type, _1), TRAEGER_FIELD(Type, _2), TRAEGER_FIELD(Type, _3)
+#define TRAEGER_FIELDS_4(Type, _1, _2, _3, _4) TRAEGER_FIELD(Type, _1), TRAEGER_FIELD(Type, _2), TRAEGER_FIELD(Type, _3), TRAEGER_FIELD(Type, _4)
+#define TRAEGER_FIELDS_5(Type, _1, _2, _3, _4, _5) TRAEGER_FIELD(Type, _1), TRAEGER_FIELD(Type, _2), TRAEGER_FIELD(Type, _3), TRAEGER_FIELD(Type, _4), TRAEGER_FIELD(Type, _5)
+#define TRAEGER_FIELDS_6(Type, _1, _2, _3, _4, _5, _6) TRAEGER_FIELD(Type, _1), TRAEGER_FIELD(Type, _2), TRAEGER_FIELD(Type, _3), TRAEGER_FIELD(Type, _4), TRAEGER_FIELD(Type, _5), TRAEGER_FIELD(Type, _6)
+#define TRAEGER_FIELDS_7(Type, _1, _2, _3, _4, _5, _6, _7) TRAEGER_FIELD(Type, _1), TRAEGER_FIELD(Type, _2), TRAEGER_FIELD(Type, _3), TRAEGER_FIELD(Type, _4), TRAEGER_FIELD(Type, _5), TRAEGER_FIELD(Type, _6), TRAEGER_FIELD(Type, _7)
+#define TRAEGER_FIELDS_8(Type, _1, _2, _3, _4, _5, _6, _7, _8) TRAEGER_FIELD(Type, _1), TRAEGER_FIELD(Type, _2), TRAEGER_FIELD(Type, _3), TRAEGER_FIELD(Type, _4), TRAEGER_FIELD(Type, _5), TRAEGER_FIELD(Type, _6), TRAEGER_FIELD(Type, _7), TRAEGER_FIELD(Type, _8)
+#define TRAEGER_FIELDS_9(Type, _1, _2, _3, _4, _5, _6, _7, _8, _9) TRAEGER_FIELD(Type, _1), TRAEGER_FIELD(Type, _2), TRAEGER_FIELD(Type, _3), TRAEGER_FIELD(Type, _4), TRAEGER_FIELD(Type, _5), TRAEGER_FIELD(Type, _6), TRAEGER_FIELD(Type, _7), TRAEGER_FIELD(Type, _8), TRAEGER_FIELD(Type, _9)
+#define TRAEGER_FIELDS_10(Type, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10) TRAEGER_FIELD(Type, _1), TRAEGER_FIELD(Type, _2), TRAEGER_FIELD(Type, _3), TRAEGER_FIELD(Type, _4), TRAEGER_FIELD(Type, _5), TRAEGER_FIELD(Type, _6), TRAEGER_FIELD(Type, _7), TRAEGER_FIELD(Type, _8), TRAEGER_FIELD(Type, _9), TRAEGER_FIELD(Type, _10)
+#define TRAEGER_FIELDS_11(Type, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11) TRAEGER_FIELD(Type, _1), TRAEGER_FIELD(Type, _2), TRAEGER_FIELD(Type, _3), TRAEGER_FIELD(Type, _4), TRAEGER_FIELD(Type, _5), TRAEGER_FIELD(Type, _6), TRAEGER_FIELD(Type, _7), TRAEGER_FIELD(Type, _8), TRAEGER_FIELD(Type, _9), TRAEGER_FIELD(Type, _10), TRAEGER_FIELD(Type, _11)
+#define TRAEGER_FIELDS_12(Type, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12) TRAEGER_FIELD(Type, _1), TRAEGER_FIELD(Type, _2), TRAEGER_FIELD(Type, _3), TRAEGER_FIELD(Type, _4), TRAEGER_FIELD(Type, _5), TRAEGER_FIELD(Type, _6), TRAEGER_FIELD(Type, _7), TRAEGER_FIELD(Type, _8), TRAEGER_FIELD(Type, _9), TRAEGER_FIELD(Type, _10), TRAEGER_FIELD(Type, _11), TRAEGER_FIELD(Type, _12)
+#define TRAEGER_FIELDS_13(Type, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13) TRAEGER_FIELD(Type, _1), TRAEGER_FIELD(Type, _2), TRAEGER_FIELD(Type, _3), TRAEGER_FIELD(Type, _4), TRAEGER_FIELD(Type, _5), TRAEGER_FIELD(Type, _6), TRAEGER_FIELD(Type, _7), TRAEGER_FIELD(Type, _8), TRAEGER_FIELD(Type, _9), TRAEGER_FIELD(Type, _10), TRAEGER_FIELD(Type, _11), TRAEGER_FIELD(Type, _12), TRAEGER_FIELD(Type, _13)
+#define TRAEGER_FIELDS_14(Type, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14) TRAEGER_FIELD(Type, _1), TRAEGER_FIELD(Type, _2), TRAEGER_FIELD(Type, _3), TRAEGER_FIELD(Type, _4), TRAEGER_FIELD(Type, _5), TRAEGER_FIELD(Type, _6), TRAEGER_FIELD(Type, _7), TRAEGER_FIELD(Type, _8), TRAEGER_FIELD(Type, _9), TRAEGER_FIELD(Type, _10), TRAEGER_FIELD(Type, _11), TRAEGER_FIELD(Type, _12), TRAEGER_FIELD(Type, _13), TRAEGER_FIELD(Type, _14)
+#define TRAEGER_FIELDS_15(Type, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15) TRAEGER_FIELD(Type, _1), TRAEGER_FIELD(Type, _2), TRAEGER_FIELD(Type, _3), TRAEGER_FIELD(Type, _4), TRAEGER_FIELD(Type, _5), TRAEGER_FIELD(Type, _6), TRAEGER_FIELD(Type, _7), TRAEGER_FIELD(Type, _8), TRAEGER_FIELD(Type, _9), TRAEGER_FIELD(Type, _10), TRAEGER_FIELD(Type, _11), TRAEGER_FIELD(Type, _12), TRAEGER_FIELD(Type, _13), TRAEGER_FIELD(Type, _14), TRAEGER_FIELD(Type, _15)
+#define TRAEGER_FIELDS_16(Type, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16) TRAEGER_FIELD(Type, _1), TRAEGER_FIELD(Type, _2), TRAEGER_FIELD(Type, _3), TRAEGER_FIELD(Type, _4), TRAEGER_FIELD(Type, _5), TRAEGER_FIELD(Type, _6), TRAEGER_FIELD(Type, _7), TRAEGER_FIELD(Type, _8), TRAEGER_FIELD(Type, _9), TRAEGER_FIELD(Type, _10), TRAEGER_FIELD(Type, _11), TRAEGER_FIELD(Type, _12), TRAEGER_FIELD(Type, _13), TRAEGER_FIELD(Type, _14), TRAEGER_FIELD(Type, _15), TRAEGER_FIELD(Type, _16)
+
+#define TRAEGER_FIELDS_SELECT(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, NAME, ...) NAME
+
+// Declares the fields of Type that are converted to and from a Value.
+// It must be used in the namespace of Type, for example:
+//
+//     struct Point
+//     {
+//         traeger::Int x;
+//         traeger::Int y;
+//     };
+//
+//     TRAEGER_FIELDS(Point, x, y)
+#define TRAEGER_FIELDS(Type, ...)                                     \
+    [[maybe_unused]] inline auto traeger_fields(const Type *) noexcept \
+    {                                                                 \
+        return std::make_tuple(                                       \
+            TRAEGER_FIELDS_SELECT(__VA_ARGS__,                        \
+                                  TRAEGER_FIELDS_16,                  \
+                                  TRAEGER_FIELDS_15,                  \
+                                  TRAEGER_FIELDS_14,                  \
+                                  TRAEGER_FIELDS_13,                  \
+                                  TRAEGER_FIELDS_12,                  \
+                                  TRAEGER_FIELDS_11,                  \
+                                  TRAEGER_FIELDS_10,                  \
+                                  TRAEGER_FIELDS_9,                   \
+                                  TRAEGER_FIELDS_8,                   \
+                                  TRAEGER_FIELDS_7,                   \
+                                  TRAEGER_FIELDS_6,                   \
+                                  TRAEGER_FIELDS_5,                   \
+                                  TRAEGER_FIELDS_4,                   \
+                                  TRAEGER_FIELDS_3,                   \
+                                  TRAEGER_FIELDS_2,                   \
+                                  TRAEGER_FIELDS_1)(Type, __VA_ARGS__)); \
+    }
@@ -0,0 +1,263 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include <immer/algorithm.hpp>
+
+#include "traeger/value/Diff.hpp"
+#include "traeger/value/Value.hpp"
+#include "traeger/value/Value_impl.hpp"
+
+namespace
+{
+    using namespace traeger;
+
+    using Result = std::pair<std::optional<Value>, String>;
+
+    auto delta_map(const Value &old_value,
+                   const Value &new_value) noexcept -> Map;
+
+    auto replace(const Value &new_value) noexcept -> Map
+    {
+        return make_map("value", new_value);
+    }
+
+    auto map_delta(const Value::impl_type::map_type &old_map,
+                   const Value::impl_type::map_type &new_map) noexcept -> Map
+    {
+        List erase;
+        Map items;
+        // The champ diff of immer skips the nodes shared by both maps, so
+        // the cost is proportional to what changed and not to the size.
+        immer::diff(
+            old_map,
+            new_map,
+            immer::make_differ(
+                [&items](const auto &added)
+                { items.set(added.first, replace(added.second.get())); },
+                [&erase](const auto &removed)
+                { erase.append(removed.first.str()); },
+                [&items](const auto &before, const auto &after)
+                {
+                    if (auto delta = delta_map(before.second.get(), after.second.get());
+                        !delta.empty())
+                    {
+                        items.set(after.first, std::move(delta));
+                    }
+                }));
+
+        Map delta;
+        if (!erase.empty())
+        {
+            delta.set("erase", std::move(erase));
+        }
+        if (!items.empty())
+        {
+            delta.set("items", std::move(items));
+        }
+        return delta;
+    }
+
+    auto list_delta(const Value::impl_type::list_type &old_list,
+                    const Value::impl_type::list_type &new_list) noexcept -> Map
+    {
+        List items;
+        const auto common_size = std::min(old_list.size(), new_list.size());
+        auto old_iter = old_list.begin();
+        auto new_iter = new_list.begin();
+        for (std::size_t index = 0; index < common_size; ++index, ++old_iter, ++new_iter)
+        {
+            // Elements shared by both lists compare by identity.
+            if (*old_iter == *new_iter)
+            {
+                continue;
+            }
+            items.append(make_list(static_cast<Int>(index), delta_map(*old_iter, *new_iter)));
+        }
+        for (auto index = common_size; index < new_list.size(); ++index, ++new_iter)
+        {
+            items.append(make_list(static_cast<Int>(index), replace(*new_iter)));
+        }
+
+        Map delta;
+        if (old_list.size() != new_list.size())
+        {
+            delta.set("size", static_cast<UInt>(new_list.size()));
+        }
+        if (!items.empty())
+        {
+            delta.set("items", std::move(items));
+        }
+        return delta;
+    }
+
+    auto delta_map(const Value &old_value,
+                   const Value &new_value) noexcept -> Map
+    {
+        const auto &old_impl = old_value.impl();
+        const auto &new_impl = new_value.impl();
+        if (old_impl.identity_equals(new_impl))
+        {
+            return Map{};
+        }
+        if (const auto *old_map = old_impl.get_map(), *new_map = new_impl.get_map();
+            old_map && new_map)
+        {
+            return map_delta(*old_map, *new_map);
+        }
+        if (const auto *old_list = old_impl.get_list(), *new_list = new_impl.get_list();
+            old_list && new_list)
+        {
+            return list_delta(*old_list, *new_list);
+        }
+        if (old_value == new_value)
+        {
+            return Map{};
+        }
+        return replace(new_value);
+    }
+
+    auto patch_map(Map map,
+                   const Map &delta) noexcept -> Result
+    {
+        if (const auto *erase = delta.find("erase"); erase)
+        {
+            const auto keys = erase->get_list();
+            if (!keys)
+            {
+                return {std::nullopt, "invalid erase of type " + erase->type_name()};
+            }
+            for (const auto &key : keys.value())
+            {
+                const auto key_string = key.get_string();
+                if (!key_string)
+                {
+                    return {std::nullopt, "invalid key of type " + key.type_name()};
+                }
+                map.erase(String{key_string.value()});
+            }
+        }
+        if (const auto *items = delta.find("items"); items)
+        {
+            const auto item_deltas = items->get_map();
+            if (!item_deltas)
+            {
+                return {std::nullopt, "invalid items of type " + items->type_name()};
+            }
+            for (const auto &[key, item_delta] : item_deltas.value())
+            {
+                const auto *item = map.find(key);
+                auto [result, error] = patch(item ? *item : Value{}, item_delta);
+                if (!result)
+                {
+                    return {std::nullopt, std::move(error)};
+                }
+                map.set(key, std::move(result).value());
+            }
+        }
+        return {map, String{}};
+    }
+
+    auto patch_list(List list,
+                    const Map &delta) noexcept -> Result
+    {
+        auto item_deltas = std::optional<List>{};
+        if (const auto *items = delta.find("items"); items)
+        {
+            item_deltas = items->get_list();
+            if (!item_deltas)
+            {
+                return {std::nullopt, "invalid items of type " + items->type_name()};
+            }
+        }
+        if (const auto *size = delta.find("size"); size)
+        {
+            const auto new_size = size->get_uint();
+            if (!new_size)
+            {
+                return {std::nullopt, "invalid size of type " + size->type_name()};
+            }
+            // Every element past the old end is given by an item, so a
+            // larger size can only come from a corrupt delta.
+            const auto items_size = item_deltas ? item_deltas->size() : 0;
+            if (new_size.value() > list.size() + items_size)
+            {
+                return {std::nullopt, "invalid size " + std::to_string(new_size.value())};
+            }
+            list.resize(new_size.value());
+        }
+        if (item_deltas)
+        {
+            for (const auto &item_delta : item_deltas.value())
+            {
+                const auto index_delta = item_delta.get_list();
+                if (!index_delta)
+                {
+                    return {std::nullopt, "invalid item of type " + item_delta.type_name()};
+                }
+                Int index = 0;
+                Value element_delta;
+                if (auto [ok, error] = index_delta->unpack(index, element_delta); !ok)
+                {
+                    return {std::nullopt, std::move(error)};
+                }
+                // The indices of a delta are never negative, and checking
+                // them before narrowing keeps them from wrapping around.
+                if (index < 0 ||
+                    static_cast<UInt>(index) >= list.size() ||
+                    index > std::numeric_limits<int>::max())
+                {
+                    return {std::nullopt, "invalid index " + std::to_string(index)};
+                }
+                const auto *element = list.find(static_cast<int>(index));
+                auto [result, error] = patch(*element, element_delta);
+                if (!result)
+                {
+                    return {std::nullopt, std::move(error)};
+                }
+                list.set(static_cast<int>(index), std::move(result).value());
+            }
+        }
+        return {list, String{}};
+    }
+}
+
+namespace traeger
+{
+    auto diff(const Value &old_value,
+              const Value &new_value) noexcept -> Value
+    {
+        return delta_map(old_value, new_value);
+    }
+
+    auto patch(const Value &base,
+               const Value &delta) noexcept -> std::pair<std::optional<Value>, String>
+    {
+        const auto changes = delta.get_map();
+        if (!changes)
+        {
+            return {std::nullopt, "invalid delta of type " + delta.type_name()};
+        }
+        if (const auto *value = changes->find("value"); value)
+        {
+            return {*value, String{}};
+        }
+        if (changes->empty())
+        {
+            return {base, String{}};
+        }
+        if (auto map = base.get_map(); map)
+        {
+            return patch_map(std::move(map).value(), changes.value());
+        }
+        if (auto list = base.get_list(); list)
+        {
+            return patch_list(std::move(list).value(), changes.value());
+        }
+        return {std::nullopt, "invalid delta for type " + base.type_name()};
+    }
+}
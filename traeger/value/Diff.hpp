@@ -0,0 +1,22 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <optional>
+#include <utility>
+
+#include <traeger/value/Types.hpp>
+
+namespace traeger
+{
+    // A delta is a map, empty when nothing changed. A value replaced as a
+    // whole is {"value": new}, a map {"erase": [keys], "items": {key: delta}}
+    // and a list {"size": new size, "items": [[index, delta]]}.
+    // Subtrees shared by both values are skipped without being visited.
+    auto diff(const Value &old_value,
+              const Value &new_value) noexcept -> Value;
+
+    // Applies a delta made by diff, patch(old, diff(old, new)) == new.
+    auto patch(const Value &base,
+               const Value &delta) noexcept -> std::pair<std::optional<Value>, String>;
+}
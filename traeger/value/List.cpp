@@ -1,11 +1,89 @@
 // SPDX-License-Identifier: BSL-1.0
 
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
 #include <utility>
 #include <optional>
 #include <ostream>
+#include <string>
+#include <vector>
 
 #include "traeger/value/Value.hpp"
 #include "traeger/value/List_impl.hpp"
+#include "traeger/value/Value_impl.hpp"
+
+namespace
+{
+    // The range constructor of immer fills the leaves of a new vector
+    // directly, which is then joined to the list in logarithmic time.
+    template <typename Iterator>
+    auto append_persistent(traeger::List::impl_type::transient_type &list,
+                           const Iterator first,
+                           const Iterator last) noexcept -> void
+    {
+        auto range = traeger::List::impl_type::persistent_type(first, last);
+        if (list.empty())
+        {
+            list = std::move(range).transient();
+        }
+        else
+        {
+            list = (std::move(list).persistent() + range).transient();
+        }
+    }
+
+    // Reads the values of a generator as an input range, each value is
+    // moved out of the iterator when it is dereferenced.
+    struct generator_iterator
+    {
+        using iterator_category = std::input_iterator_tag;
+        using value_type = traeger::Value;
+        using difference_type = std::ptrdiff_t;
+        using pointer = traeger::Value *;
+        using reference = traeger::Value &&;
+
+        explicit generator_iterator(const std::function<bool(traeger::Value &)> *generator)
+            : generator(generator)
+        {
+            next();
+        }
+
+        auto operator*() -> reference
+        {
+            return std::move(value);
+        }
+
+        auto operator++() -> generator_iterator &
+        {
+            next();
+            return *this;
+        }
+
+        auto operator==(const generator_iterator &other) const noexcept -> bool
+        {
+            return generator == other.generator;
+        }
+
+        auto operator!=(const generator_iterator &other) const noexcept -> bool
+        {
+            return generator != other.generator;
+        }
+
+    private:
+        auto next() -> void
+        {
+            if (generator != nullptr && !(*generator)(value))
+            {
+                generator = nullptr;
+            }
+        }
+
+        const std::function<bool(traeger::Value &)> *generator;
+        traeger::Value value;
+    };
+}
 
 namespace traeger
 {
@@ -81,12 +159,15 @@ namespace traeger
 
     auto List::operator==(const List &other) const noexcept -> bool
     {
-        return impl().persistent() == other.impl().persistent();
+        const auto &list = impl().list;
+        const auto &other_list = other.impl().list;
+        return list.size() == other_list.size() &&
+               std::equal(list.begin(), list.end(), other_list.begin());
     }
 
     auto List::operator!=(const List &other) const noexcept -> bool
     {
-        return impl().persistent() != other.impl().persistent();
+        return !(*this == other);
     }
 
     auto List::append(const Value &value) noexcept -> void
@@ -99,6 +180,64 @@ namespace traeger
         impl().list.push_back(std::move(value));
     }
 
+    auto List::append_range(const Value *first,
+                            const Value *last) noexcept -> void
+    {
+        append_persistent(impl().list, first, last);
+    }
+
+    auto List::append_range(std::vector<Value> &&values) noexcept -> void
+    {
+        append_persistent(impl().list,
+                          std::make_move_iterator(values.begin()),
+                          std::make_move_iterator(values.end()));
+    }
+
+    auto List::append_range(const Bool *first,
+                            const Bool *last) noexcept -> void
+    {
+        append_persistent(impl().list, first, last);
+    }
+
+    auto List::append_range(const Int *first,
+                            const Int *last) noexcept -> void
+    {
+        append_persistent(impl().list, first, last);
+    }
+
+    auto List::append_range(const UInt *first,
+                            const UInt *last) noexcept -> void
+    {
+        append_persistent(impl().list, first, last);
+    }
+
+    auto List::append_range(const Float *first,
+                            const Float *last) noexcept -> void
+    {
+        append_persistent(impl().list, first, last);
+    }
+
+    auto List::from_range(const Value *first,
+                          const Value *last) noexcept -> List
+    {
+        List list;
+        list.append_range(first, last);
+        return list;
+    }
+
+    auto List::from_range(std::vector<Value> &&values) noexcept -> List
+    {
+        List list;
+        list.append_range(std::move(values));
+        return list;
+    }
+
+    auto List::from_generator(const std::function<bool(Value &)> &generator) -> List
+    {
+        return List{impl_type{impl_type::persistent_type(generator_iterator{&generator},
+                                                         generator_iterator{nullptr})}};
+    }
+
     auto List::set(const int index,
                    const Value &value) noexcept -> bool
     {
@@ -130,7 +269,7 @@ namespace traeger
         const auto size_ = size();
         if (const std::size_t position = index < 0 ? index + size_ : index; position < size_)
         {
-            return &impl().list[position].get();
+            return &impl().list[position];
         }
         return nullptr;
     }
@@ -163,6 +302,98 @@ namespace traeger
         return size();
     }
 
+    auto List::slice(const int first,
+                     const int last) const noexcept -> List
+    {
+        const auto size_ = static_cast<std::ptrdiff_t>(size());
+        const auto position = [size_](const int index) -> std::size_t
+        {
+            return std::clamp<std::ptrdiff_t>(index < 0 ? index + size_ : index, 0, size_);
+        };
+        const auto begin = position(first);
+        const auto end = std::max(begin, position(last));
+        return List{impl_type{impl().persistent().take(end).drop(begin)}};
+    }
+
+    auto List::concat(const List &other) const noexcept -> List
+    {
+        return List{impl_type{impl().persistent() + other.impl().persistent()}};
+    }
+
+    auto List::leaf_size() noexcept -> std::size_t
+    {
+        return std::size_t{1} << impl_type::persistent_type::bits_leaf;
+    }
+
+    auto List::insert(const int index,
+                      const Value &value) noexcept -> bool
+    {
+        const auto size_ = size();
+        if (const std::size_t position = index < 0 ? index + size_ : index;
+            position <= size_)
+        {
+            auto &list = impl().list;
+            list = std::move(list).persistent().insert(position, value).transient();
+            return true;
+        }
+        return false;
+    }
+
+    auto List::insert(const int index,
+                      Value &&value) noexcept -> bool
+    {
+        const auto size_ = size();
+        if (const std::size_t position = index < 0 ? index + size_ : index;
+            position <= size_)
+        {
+            auto &list = impl().list;
+            list = std::move(list).persistent().insert(position, std::move(value)).transient();
+            return true;
+        }
+        return false;
+    }
+
+    auto List::erase(const int index) noexcept -> bool
+    {
+        const auto size_ = size();
+        if (const std::size_t position = index < 0 ? index + size_ : index;
+            position < size_)
+        {
+            auto &list = impl().list;
+            list = std::move(list).persistent().erase(position).transient();
+            return true;
+        }
+        return false;
+    }
+
+    auto List::get_in(const List &path) const noexcept -> const Value *
+    {
+        const auto &steps = path.impl().list;
+        if (steps.empty())
+        {
+            return nullptr;
+        }
+        return Value::impl_type::find_in(impl().list, steps.begin(), steps.end());
+    }
+
+    auto List::set_in(const List &path,
+                      const Value &value) noexcept -> bool
+    {
+        return update_in(path, [&value](const Value &)
+                         { return value; });
+    }
+
+    auto List::update_in(const List &path,
+                         const Update &update) noexcept -> bool
+    {
+        const auto &steps = path.impl().list;
+        if (steps.empty())
+        {
+            return false;
+        }
+        return Value::impl_type::update_in(impl().list, steps.begin(), steps.end(), update);
+    }
+
     List::Iterator::impl_type::impl_type(const iterator_type &begin, const iterator_type &end) noexcept
         : begin(begin),
           end(end)
@@ -179,6 +410,11 @@ namespace traeger
         new (impl_) impl_type{list.impl().list.begin(), list.impl().list.end()};
     }
 
+    List::Iterator::Iterator(impl_type &&other_impl) noexcept
+    {
+        new (impl_) impl_type{std::move(other_impl)};
+    }
+
     List::Iterator::operator bool() const noexcept
     {
         return impl().begin != impl().end;
@@ -186,12 +422,12 @@ namespace traeger
 
     auto List::Iterator::value() const noexcept -> const Value &
     {
-        return impl().begin->get();
+        return *impl().begin;
     }
 
     auto List::Iterator::operator*() const noexcept -> const Value &
     {
-        return impl().begin->get();
+        return *impl().begin;
     }
 
     auto List::Iterator::increment() noexcept -> bool
@@ -230,6 +466,26 @@ namespace traeger
         return false;
     }
 
+    auto List::DecodeError::message() const -> String
+    {
+        switch (code)
+        {
+        case Code::None:
+            break;
+        case Code::Size:
+            return "expected " + std::to_string(expected) +
+                   " arguments but " + std::to_string(given) +
+                   " were given";
+        case Code::Index:
+            return "invalid index in argument " + std::to_string(index);
+        case Code::Cast:
+            return "invalid cast in argument " + std::to_string(index) +
+                   " from type " + *from +
+                   " to " + *to;
+        }
+        return String{};
+    }
+
     auto operator<<(std::ostream &os,
                     const List &list) noexcept -> std::ostream &
     {
@@ -4,12 +4,14 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <exception>
+#include <functional>
+#include <optional>
 #include <ostream>
 #include <stdexcept>
 #include <string>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include <traeger/value/Types.hpp>
 
@@ -53,6 +55,55 @@ namespace traeger
 
         auto append(Value &&value) noexcept -> void;
 
+        // The ranges are built into a new vector by its range constructor
+        // and appended with a single concatenation.
+        auto append_range(const Value *first,
+                          const Value *last) noexcept -> void;
+
+        auto append_range(std::vector<Value> &&values) noexcept -> void;
+
+        auto append_range(const Bool *first,
+                          const Bool *last) noexcept -> void;
+
+        auto append_range(const Int *first,
+                          const Int *last) noexcept -> void;
+
+        auto append_range(const UInt *first,
+                          const UInt *last) noexcept -> void;
+
+        auto append_range(const Float *first,
+                          const Float *last) noexcept -> void;
+
+        static auto from_range(const Value *first,
+                               const Value *last) noexcept -> List;
+
+        static auto from_range(std::vector<Value> &&values) noexcept -> List;
+
+        // The generator stores the next value and returns true until the
+        // values run out. They go straight into the range constructor
+        // without being collected first.
+        static auto from_generator(const std::function<bool(Value &)> &generator) -> List;
+
+        // Builds the list from transform applied to every element of the
+        // range, e.g. the nodes of a decoded document.
+        template <typename Iterator, typename Sentinel, typename Transform>
+        static auto from_range(Iterator first,
+                               const Sentinel last,
+                               Transform &&transform) -> List
+        {
+            return from_generator(
+                [&first, &last, &transform](Value &value) -> bool
+                {
+                    if (first == last)
+                    {
+                        return false;
+                    }
+                    value = transform(*first);
+                    ++first;
+                    return true;
+                });
+        }
+
         auto set(int index,
                  const Value &value) noexcept -> bool;
 
@@ -67,32 +118,98 @@ namespace traeger
 
         auto resize(std::size_t new_size) noexcept -> std::size_t;
 
+        // Slicing, concatenation, insertion and erasure share the untouched
+        // nodes and take logarithmic time.
+        // The slice has the elements from first up to last, negative indices
+        // count from the end and out of range ones are clamped.
+        auto slice(int first,
+                   int last) const noexcept -> List;
+
+        auto concat(const List &other) const noexcept -> List;
+
+        // Elements in a leaf of the vector, a slice whose bounds are
+        // multiples of it shares all of its nodes with the list.
+        static auto leaf_size() noexcept -> std::size_t;
+
+        // Inserting at the size of the list appends to it.
+        auto insert(int index,
+                    const Value &value) noexcept -> bool;
+
+        auto insert(int index,
+                    Value &&value) noexcept -> bool;
+
+        auto erase(int index) noexcept -> bool;
+
+        // A path is a list of map keys and list indices. The updates copy
+        // only the nodes along the path and leave the list untouched when
+        // the path does not exist.
+        auto get_in(const List &path) const noexcept -> const Value *;
+
+        auto set_in(const List &path,
+                    const Value &value) noexcept -> bool;
+
+        auto update_in(const List &path,
+                       const Update &update) noexcept -> bool;
+
+        struct DecodeError
+        {
+            enum class Code : int
+            {
+                None = 0,
+                Size = 1,
+                Index = 2,
+                Cast = 3,
+            };
+
+            Code code = Code::None;
+            int index = 0;
+            std::size_t expected = 0;
+            std::size_t given = 0;
+            const String *from = nullptr;
+            const String *to = nullptr;
+
+            explicit operator bool() const noexcept
+            {
+                return code != Code::None;
+            }
+
+            auto message() const -> String;
+        };
+
         template <typename... Args>
-        auto get_tuple() const -> std::tuple<Args...>
+        auto try_get_tuple() const noexcept -> std::pair<std::optional<std::tuple<Args...>>, DecodeError>
         {
             constexpr auto n_args = sizeof...(Args);
             if (n_args != size())
             {
-                throw std::runtime_error(
-                    "expected " + std::to_string(n_args) +
-                    " arguments but " + std::to_string(size()) +
-                    " were given");
+                return {std::nullopt, DecodeError{DecodeError::Code::Size, 0, n_args, size()}};
             }
-            return get_index_sequence<std::tuple<Args...>>(std::make_integer_sequence<int, n_args>());
+            auto error = DecodeError{};
+            auto tuple = get_index_sequence<std::tuple<Args...>>(std::make_integer_sequence<int, n_args>(), error);
+            return {std::move(tuple), error};
         }
 
         template <typename... Args>
-        auto unpack(Args &...args) const -> std::pair<bool, String>
+        auto get_tuple() const -> std::tuple<Args...>
         {
-            try
+            auto [tuple, error] = try_get_tuple<Args...>();
+            if (!tuple)
             {
-                std::tie(args...) = get_tuple<Args...>();
-                return {true, String{}};
+                throw std::runtime_error(error.message());
             }
-            catch (const std::exception &e)
+            return std::move(tuple).value();
+        }
+
+        template <typename... Args>
+        auto unpack(Args &...args) const noexcept -> std::pair<bool, String>
+        {
+            auto [tuple, error] = try_get_tuple<Args...>();
+            if (!tuple)
             {
-                return {false, e.what()};
+                return {false, error.message()};
             }
+            std::tie(args...) = std::move(tuple).value();
+            return {true, String{}};
         }
 
         template <typename... Args>
@@ -127,6 +244,8 @@ namespace traeger
 
             explicit Iterator(const List &list) noexcept;
 
+            explicit Iterator(impl_type &&other_impl) noexcept;
+
             explicit operator bool() const noexcept;
 
             auto operator!=(bool end) const noexcept -> bool;
@@ -167,12 +286,19 @@ namespace traeger
 
     private:
         template <int Index, typename Arg>
-        auto get_index_arg() const -> Arg;
+        auto get_index_arg(DecodeError &error) const noexcept -> std::optional<Arg>;
 
         template <typename Tuple, int... index>
-        auto get_index_sequence(std::integer_sequence<int, index...>) const -> Tuple
+        auto get_index_sequence(std::integer_sequence<int, index...>,
+                                DecodeError &error) const noexcept -> std::optional<Tuple>
         {
-            return std::make_tuple(get_index_arg<index, std::tuple_element_t<index, Tuple>>()...);
+            [[maybe_unused]] auto optionals = std::tuple<std::optional<std::tuple_element_t<index, Tuple>>...>{
+                get_index_arg<index, std::tuple_element_t<index, Tuple>>(error)...};
+            if (error)
+            {
+                return std::nullopt;
+            }
+            return Tuple{std::move(std::get<index>(optionals)).value()...};
         }
 
         std::byte impl_[sizeof(layout_type)]{};
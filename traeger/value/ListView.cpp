@@ -0,0 +1,49 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include "traeger/value/ListView.hpp"
+#include "traeger/value/Value_impl.hpp"
+
+namespace traeger
+{
+    ListView::ListView(const Value &value) noexcept
+        : value_(&value)
+    {
+    }
+
+    auto ListView::find(const int index) const noexcept -> const Value *
+    {
+        const auto &list = *value_->impl().get_list();
+        const auto size_ = list.size();
+        if (const std::size_t position = index < 0 ? index + size_ : index; position < size_)
+        {
+            return &list[position];
+        }
+        return nullptr;
+    }
+
+    auto ListView::empty() const noexcept -> bool
+    {
+        return value_->impl().get_list()->empty();
+    }
+
+    auto ListView::size() const noexcept -> std::size_t
+    {
+        return value_->impl().get_list()->size();
+    }
+
+    auto ListView::list() const noexcept -> List
+    {
+        return List{List::impl_type{*value_->impl().get_list()}};
+    }
+
+    auto ListView::begin() const noexcept -> List::Iterator
+    {
+        const auto &list = *value_->impl().get_list();
+        return List::Iterator{List::Iterator::impl_type{list.begin(), list.end()}};
+    }
+
+    auto ListView::end() noexcept -> bool
+    {
+        return false;
+    }
+}
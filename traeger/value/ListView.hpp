@@ -0,0 +1,46 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <cstddef>
+
+#include <traeger/value/Types.hpp>
+#include <traeger/value/List.hpp>
+
+namespace traeger
+{
+    // A read only view of the list held by a Value. It borrows the value
+    // instead of building a List from it, so it is valid only as long as
+    // the value is neither modified nor destroyed.
+    struct ListView
+    {
+        auto find(int index) const noexcept -> const Value *;
+
+        auto empty() const noexcept -> bool;
+
+        auto size() const noexcept -> std::size_t;
+
+        auto list() const noexcept -> List;
+
+        auto begin() const noexcept -> List::Iterator;
+
+        static auto end() noexcept -> bool;
+
+    private:
+        friend struct Value;
+
+        explicit ListView(const Value &value) noexcept;
+
+        const Value *value_;
+    };
+}
+
+inline auto begin(const traeger::ListView &view) -> traeger::List::Iterator
+{
+    return view.begin();
+}
+
+inline auto end(const traeger::ListView &) -> bool
+{
+    return traeger::ListView::end();
+}
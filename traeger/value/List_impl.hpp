@@ -2,19 +2,25 @@
 
 #pragma once
 
-#include <immer/box.hpp>
-#include <immer/vector.hpp>
-#include <immer/vector_transient.hpp>
+#include <immer/flex_vector.hpp>
+#include <immer/flex_vector_transient.hpp>
 
 #include "traeger/value/List.hpp"
+#include "traeger/value/Memory_impl.hpp"
+#include "traeger/value/Value.hpp"
 
 namespace traeger
 {
     struct List::impl_type
     {
-        using value_type = immer::box<Value>;
-        using persistent_type = immer::vector<value_type>;
-        using transient_type = immer::vector_transient<value_type>;
+        // Values are stored in place in the leaves of the vector, they are
+        // already small handles so boxing them would only add an indirection.
+        // A flex_vector costs the same as a vector to append to and iterate,
+        // and it can also be sliced, concatenated and inserted into in
+        // logarithmic time.
+        using value_type = Value;
+        using persistent_type = immer::flex_vector<value_type, memory_policy>;
+        using transient_type = immer::flex_vector_transient<value_type, memory_policy>;
 
         ~impl_type() noexcept = default;
 
@@ -0,0 +1,212 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <algorithm>
+#include <ostream>
+#include <utility>
+
+#include "traeger/value/Value.hpp"
+#include "traeger/value/List_impl.hpp"
+#include "traeger/value/Local_impl.hpp"
+
+namespace traeger
+{
+    LocalList::~LocalList() noexcept
+    {
+        impl().~impl_type();
+    }
+
+    LocalList::LocalList() noexcept
+    {
+        new (impl_) impl_type{};
+    }
+
+    LocalList::LocalList(const LocalList &other) noexcept
+        : LocalList()
+    {
+        impl().list = other.impl().list;
+    }
+
+    LocalList::LocalList(LocalList &&other) noexcept
+        : LocalList()
+    {
+        impl().list = std::move(other.impl().list);
+    }
+
+    LocalList::LocalList(const List &list) noexcept
+        : LocalList()
+    {
+        for (const auto &value : list.impl().list)
+        {
+            impl().list.push_back(value);
+        }
+    }
+
+    auto LocalList::operator=(const LocalList &other) noexcept -> LocalList &
+    {
+        if (this != &other)
+        {
+            impl().list = other.impl().list;
+        }
+        return *this;
+    }
+
+    auto LocalList::operator=(LocalList &&other) noexcept -> LocalList &
+    {
+        impl().list = std::move(other.impl().list);
+        return *this;
+    }
+
+    auto LocalList::operator==(const LocalList &other) const noexcept -> bool
+    {
+        const auto &list = impl().list;
+        const auto &other_list = other.impl().list;
+        return list.size() == other_list.size() &&
+               std::equal(list.begin(), list.end(), other_list.begin());
+    }
+
+    auto LocalList::operator!=(const LocalList &other) const noexcept -> bool
+    {
+        return !(*this == other);
+    }
+
+    auto LocalList::append(const Value &value) noexcept -> void
+    {
+        impl().list.push_back(value);
+    }
+
+    auto LocalList::append(Value &&value) noexcept -> void
+    {
+        impl().list.push_back(std::move(value));
+    }
+
+    auto LocalList::set(const int index,
+                        const Value &value) noexcept -> bool
+    {
+        const auto size_ = size();
+        if (const std::size_t position = index < 0 ? index + size_ : index;
+            position < size_)
+        {
+            impl().list.set(position, value);
+            return true;
+        }
+        return false;
+    }
+
+    auto LocalList::set(const int index,
+                        Value &&value) noexcept -> bool
+    {
+        const auto size_ = size();
+        if (const std::size_t position = index < 0 ? index + size_ : index;
+            position < size_)
+        {
+            impl().list.set(position, std::move(value));
+            return true;
+        }
+        return false;
+    }
+
+    auto LocalList::find(const int index) const noexcept -> const Value *
+    {
+        const auto size_ = size();
+        if (const std::size_t position = index < 0 ? index + size_ : index; position < size_)
+        {
+            return &impl().list[position];
+        }
+        return nullptr;
+    }
+
+    auto LocalList::empty() const noexcept -> bool
+    {
+        return impl().list.empty();
+    }
+
+    auto LocalList::size() const noexcept -> std::size_t
+    {
+        return impl().list.size();
+    }
+
+    auto LocalList::share() const noexcept -> List
+    {
+        List list;
+        for (const auto &value : impl().list)
+        {
+            list.impl().list.push_back(value);
+        }
+        return list;
+    }
+
+    LocalList::Iterator::~Iterator() noexcept
+    {
+        impl().~impl_type();
+    }
+
+    LocalList::Iterator::Iterator(const LocalList &list) noexcept
+    {
+        new (impl_) impl_type{list.impl().list.begin(), list.impl().list.end()};
+    }
+
+    LocalList::Iterator::operator bool() const noexcept
+    {
+        return impl().begin != impl().end;
+    }
+
+    auto LocalList::Iterator::value() const noexcept -> const Value &
+    {
+        return *impl().begin;
+    }
+
+    auto LocalList::Iterator::operator*() const noexcept -> const Value &
+    {
+        return *impl().begin;
+    }
+
+    auto LocalList::Iterator::increment() noexcept -> bool
+    {
+        if (*this)
+        {
+            ++impl().begin;
+            return static_cast<bool>(*this);
+        }
+        return false;
+    }
+
+    auto LocalList::Iterator::operator++() noexcept -> Iterator &
+    {
+        increment();
+        return *this;
+    }
+
+    auto LocalList::Iterator::operator!=(const bool end) const noexcept -> bool
+    {
+        return static_cast<bool>(*this) != end;
+    }
+
+    auto LocalList::Iterator::operator==(const bool end) const noexcept -> bool
+    {
+        return static_cast<bool>(*this) == end;
+    }
+
+    auto LocalList::begin() const noexcept -> Iterator
+    {
+        return Iterator{*this};
+    }
+
+    auto LocalList::end() noexcept -> bool
+    {
+        return false;
+    }
+
+    auto operator<<(std::ostream &os,
+                    const LocalList &list) noexcept -> std::ostream &
+    {
+        auto iter = list.begin();
+        os << '[';
+        for (bool is_first = true; iter; ++iter)
+        {
+            (is_first ? (is_first = false, os) : os << ", ")
+                << iter.value();
+        }
+        os << ']';
+        return os;
+    }
+}
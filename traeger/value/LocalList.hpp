@@ -0,0 +1,132 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <cstddef>
+#include <ostream>
+
+#include <traeger/value/Types.hpp>
+#include <traeger/value/List.hpp>
+
+namespace traeger
+{
+    // A List whose nodes use non atomic reference counts. It is meant for
+    // scratch computation confined to one thread, e.g. inside an actor
+    // method, and can not become a Value: share() converts it to a List
+    // before it crosses a Mailbox or a Promise.
+    //
+    // Only the top level is local, there is no local flavor of Value. The
+    // elements are ordinary values, so the lists and maps nested in them
+    // keep atomic counts, and copying them still pays for atomic updates.
+    // A nested container that is updated in a hot loop has to be taken
+    // out into its own LocalList or LocalMap. Converting from a List and
+    // share() both copy every element, which is linear in the size.
+    struct LocalList
+    {
+        struct impl_type;
+
+        auto impl() const & noexcept -> const impl_type &
+        {
+            return *reinterpret_cast<const impl_type *>(impl_);
+        }
+
+        auto impl() & noexcept -> impl_type &
+        {
+            return *reinterpret_cast<impl_type *>(impl_);
+        }
+
+        ~LocalList() noexcept;
+
+        LocalList() noexcept;
+
+        LocalList(const LocalList &other) noexcept;
+
+        LocalList(LocalList &&other) noexcept;
+
+        explicit LocalList(const List &list) noexcept;
+
+        auto operator=(const LocalList &other) noexcept -> LocalList &;
+
+        auto operator=(LocalList &&other) noexcept -> LocalList &;
+
+        auto operator==(const LocalList &other) const noexcept -> bool;
+
+        auto operator!=(const LocalList &other) const noexcept -> bool;
+
+        auto append(const Value &value) noexcept -> void;
+
+        auto append(Value &&value) noexcept -> void;
+
+        auto set(int index,
+                 const Value &value) noexcept -> bool;
+
+        auto set(int index,
+                 Value &&value) noexcept -> bool;
+
+        auto find(int index) const noexcept -> const Value *;
+
+        auto empty() const noexcept -> bool;
+
+        auto size() const noexcept -> std::size_t;
+
+        // Copies every element, nested lists and maps are shared as is.
+        auto share() const noexcept -> List;
+
+        struct Iterator
+        {
+            struct impl_type;
+
+            auto impl() const & noexcept -> const impl_type &
+            {
+                return *reinterpret_cast<const impl_type *>(impl_);
+            }
+
+            auto impl() & noexcept -> impl_type &
+            {
+                return *reinterpret_cast<impl_type *>(impl_);
+            }
+
+            ~Iterator() noexcept;
+
+            explicit Iterator(const LocalList &list) noexcept;
+
+            explicit operator bool() const noexcept;
+
+            auto operator!=(bool end) const noexcept -> bool;
+
+            auto operator==(bool end) const noexcept -> bool;
+
+            auto value() const noexcept -> const Value &;
+            auto operator*() const noexcept -> const Value &;
+
+            auto increment() noexcept -> bool;
+            auto operator++() noexcept -> Iterator &;
+
+            using layout_type = List::Iterator::layout_type;
+
+        private:
+            std::byte impl_[sizeof(layout_type)]{};
+        };
+
+        auto begin() const noexcept -> Iterator;
+        static auto end() noexcept -> bool;
+
+        using layout_type = List::layout_type;
+
+    private:
+        std::byte impl_[sizeof(layout_type)]{};
+    };
+
+    auto operator<<(std::ostream &os,
+                    const LocalList &list) noexcept -> std::ostream &;
+}
+
+inline auto begin(const traeger::LocalList &list) -> traeger::LocalList::Iterator
+{
+    return list.begin();
+}
+
+inline auto end(const traeger::LocalList &) -> bool
+{
+    return traeger::LocalList::end();
+}
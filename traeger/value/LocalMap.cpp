@@ -0,0 +1,181 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <iomanip>
+#include <ostream>
+#include <utility>
+
+#include "traeger/value/Value.hpp"
+#include "traeger/value/Map_impl.hpp"
+#include "traeger/value/Local_impl.hpp"
+
+namespace traeger
+{
+    LocalMap::~LocalMap() noexcept
+    {
+        impl().~impl_type();
+    }
+
+    LocalMap::LocalMap() noexcept
+    {
+        new (impl_) impl_type{};
+    }
+
+    LocalMap::LocalMap(const LocalMap &other) noexcept
+        : LocalMap()
+    {
+        impl().map = other.impl().map;
+    }
+
+    LocalMap::LocalMap(LocalMap &&other) noexcept
+        : LocalMap()
+    {
+        impl().map = std::move(other.impl().map);
+    }
+
+    LocalMap::LocalMap(const Map &map) noexcept
+        : LocalMap()
+    {
+        for (const auto &[key, value] : map.impl().map)
+        {
+            impl().map.set(key, value.get());
+        }
+    }
+
+    auto LocalMap::operator=(const LocalMap &other) noexcept -> LocalMap &
+    {
+        if (this != &other)
+        {
+            impl().map = other.impl().map;
+        }
+        return *this;
+    }
+
+    auto LocalMap::operator=(LocalMap &&other) noexcept -> LocalMap &
+    {
+        impl().map = std::move(other.impl().map);
+        return *this;
+    }
+
+    auto LocalMap::operator==(const LocalMap &other) const noexcept -> bool
+    {
+        if (size() != other.size())
+        {
+            return false;
+        }
+        for (const auto &[key, value] : impl().map)
+        {
+            const auto *other_value = other.impl().map.find(key);
+            if (other_value == nullptr || other_value->get() != value.get())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    auto LocalMap::operator!=(const LocalMap &other) const noexcept -> bool
+    {
+        return !(*this == other);
+    }
+
+    auto LocalMap::set(const String &key,
+                       const Value &value) noexcept -> void
+    {
+        set(Atom{key}, value);
+    }
+
+    auto LocalMap::set(const String &key,
+                       Value &&value) noexcept -> void
+    {
+        set(Atom{key}, std::move(value));
+    }
+
+    auto LocalMap::erase(const String &key) noexcept -> void
+    {
+        if (const auto atom = Atom::find(key); atom)
+        {
+            erase(atom.value());
+        }
+    }
+
+    auto LocalMap::contains(const String &key) const noexcept -> bool
+    {
+        const auto atom = Atom::find(key);
+        return atom && contains(atom.value());
+    }
+
+    auto LocalMap::find(const String &key) const noexcept -> const Value *
+    {
+        if (const auto atom = Atom::find(key); atom)
+        {
+            return find(atom.value());
+        }
+        return nullptr;
+    }
+
+    auto LocalMap::set(const Atom &key,
+                       const Value &value) noexcept -> void
+    {
+        impl().map.set(key, value);
+    }
+
+    auto LocalMap::set(const Atom &key,
+                       Value &&value) noexcept -> void
+    {
+        impl().map.set(key, std::move(value));
+    }
+
+    auto LocalMap::erase(const Atom &key) noexcept -> void
+    {
+        impl().map.erase(key);
+    }
+
+    auto LocalMap::contains(const Atom &key) const noexcept -> bool
+    {
+        return impl().map.find(key) != nullptr;
+    }
+
+    auto LocalMap::find(const Atom &key) const noexcept -> const Value *
+    {
+        if (const auto *value_ptr = impl().map.find(key); value_ptr)
+        {
+            return &value_ptr->get();
+        }
+        return nullptr;
+    }
+
+    auto LocalMap::empty() const noexcept -> bool
+    {
+        return impl().map.empty();
+    }
+
+    auto LocalMap::size() const noexcept -> std::size_t
+    {
+        return impl().map.size();
+    }
+
+    auto LocalMap::share() const noexcept -> Map
+    {
+        Map map;
+        for (const auto &[key, value] : impl().map)
+        {
+            map.set(key, value.get());
+        }
+        return map;
+    }
+
+    auto operator<<(std::ostream &os,
+                    const LocalMap &map) noexcept -> std::ostream &
+    {
+        os << '{';
+        auto is_first = true;
+        for (const auto &[key, value] : map.impl().map)
+        {
+            (is_first ? (is_first = false, os) : os << ", ")
+                << std::quoted(key.str())
+                << ':' << value.get();
+        }
+        os << '}';
+        return os;
+    }
+}
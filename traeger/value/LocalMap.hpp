@@ -0,0 +1,90 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <cstddef>
+#include <ostream>
+
+#include <traeger/value/Types.hpp>
+#include <traeger/value/Atom.hpp>
+#include <traeger/value/Map.hpp>
+
+namespace traeger
+{
+    // A Map whose nodes use non atomic reference counts, the counterpart
+    // of LocalList. share() converts it to a Map, it is the only way out,
+    // neither a Value nor a Map can be built from a LocalMap. As with
+    // LocalList only the top level is local, and both conversions are
+    // linear in the size.
+    struct LocalMap
+    {
+        struct impl_type;
+
+        auto impl() const & noexcept -> const impl_type &
+        {
+            return *reinterpret_cast<const impl_type *>(impl_);
+        }
+
+        auto impl() & noexcept -> impl_type &
+        {
+            return *reinterpret_cast<impl_type *>(impl_);
+        }
+
+        ~LocalMap() noexcept;
+
+        LocalMap() noexcept;
+
+        LocalMap(const LocalMap &other) noexcept;
+
+        LocalMap(LocalMap &&other) noexcept;
+
+        explicit LocalMap(const Map &map) noexcept;
+
+        auto operator=(const LocalMap &other) noexcept -> LocalMap &;
+
+        auto operator=(LocalMap &&other) noexcept -> LocalMap &;
+
+        auto operator==(const LocalMap &other) const noexcept -> bool;
+
+        auto operator!=(const LocalMap &other) const noexcept -> bool;
+
+        auto set(const String &key,
+                 const Value &value) noexcept -> void;
+
+        auto set(const String &key,
+                 Value &&value) noexcept -> void;
+
+        auto erase(const String &key) noexcept -> void;
+
+        auto contains(const String &key) const noexcept -> bool;
+
+        auto find(const String &key) const noexcept -> const Value *;
+
+        auto set(const Atom &key,
+                 const Value &value) noexcept -> void;
+
+        auto set(const Atom &key,
+                 Value &&value) noexcept -> void;
+
+        auto erase(const Atom &key) noexcept -> void;
+
+        auto contains(const Atom &key) const noexcept -> bool;
+
+        auto find(const Atom &key) const noexcept -> const Value *;
+
+        auto empty() const noexcept -> bool;
+
+        auto size() const noexcept -> std::size_t;
+
+        // Copies every entry, nested lists and maps are shared as is.
+        auto share() const noexcept -> Map;
+
+        using layout_type = Map::layout_type;
+
+    private:
+        std::byte impl_[sizeof(layout_type)]{};
+    };
+
+    auto operator<<(std::ostream &os,
+                    const LocalMap &map) noexcept -> std::ostream &;
+}
@@ -0,0 +1,49 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <functional>
+
+#include <immer/box.hpp>
+#include <immer/map.hpp>
+#include <immer/map_transient.hpp>
+#include <immer/vector.hpp>
+#include <immer/vector_transient.hpp>
+
+#include "traeger/value/LocalList.hpp"
+#include "traeger/value/LocalMap.hpp"
+#include "traeger/value/Memory_impl.hpp"
+#include "traeger/value/Value.hpp"
+
+namespace traeger
+{
+    struct LocalList::impl_type
+    {
+        using value_type = Value;
+        using transient_type = immer::vector_transient<value_type, local_memory_policy>;
+
+        static_assert(sizeof(layout_type) == sizeof(transient_type));
+
+        transient_type list;
+    };
+
+    struct LocalList::Iterator::impl_type
+    {
+        using iterator_type = LocalList::impl_type::transient_type::iterator;
+
+        static_assert(sizeof(layout_type) == 2 * sizeof(iterator_type));
+
+        iterator_type begin, end;
+    };
+
+    struct LocalMap::impl_type
+    {
+        using key_type = Atom;
+        using value_type = immer::box<Value, local_memory_policy>;
+        using transient_type = immer::map_transient<key_type, value_type, std::hash<key_type>, std::equal_to<key_type>, local_memory_policy>;
+
+        static_assert(sizeof(layout_type) == sizeof(transient_type));
+
+        transient_type map;
+    };
+}
@@ -1,11 +1,14 @@
 // SPDX-License-Identifier: BSL-1.0
 
+#include <functional>
 #include <iomanip>
 #include <ostream>
 #include <utility>
+#include <vector>
 
 #include "traeger/value/Value.hpp"
 #include "traeger/value/Map_impl.hpp"
+#include "traeger/value/Value_impl.hpp"
 
 namespace traeger
 {
@@ -81,37 +84,92 @@ namespace traeger
 
     auto Map::operator==(const Map &other) const noexcept -> bool
     {
-        return impl().persistent() == other.impl().persistent();
+        const auto &map = impl().map;
+        const auto &other_map = other.impl().map;
+        if (map.size() != other_map.size())
+        {
+            return false;
+        }
+        for (const auto &[key, value] : map)
+        {
+            const auto *other_value = other_map.find(key);
+            if (other_value == nullptr)
+            {
+                return false;
+            }
+            // Boxes shared by both maps hold the same value.
+            if (&other_value->get() != &value.get() &&
+                other_value->get() != value.get())
+            {
+                return false;
+            }
+        }
+        return true;
     }
 
     auto Map::operator!=(const Map &other) const noexcept -> bool
     {
-        return impl().persistent() != other.impl().persistent();
+        return !(*this == other);
     }
 
     auto Map::set(const String &key,
                   const Value &value) noexcept -> void
     {
-        impl().map.set(key, value);
+        set(Atom{key}, value);
     }
 
     auto Map::set(const String &key,
                   Value &&value) noexcept -> void
     {
-        impl().map.set(key, std::move(value));
+        set(Atom{key}, std::move(value));
     }
 
     auto Map::erase(const String &key) noexcept -> void
     {
-        impl().map.erase(key);
+        if (const auto atom = Atom::find(key); atom)
+        {
+            erase(atom.value());
+        }
     }
 
     auto Map::contains(const String &key) const noexcept -> bool
     {
-        return impl().map.find(key) != nullptr;
+        const auto atom = Atom::find(key);
+        return atom && contains(atom.value());
     }
 
     auto Map::find(const String &key) const noexcept -> const Value *
+    {
+        if (const auto atom = Atom::find(key); atom)
+        {
+            return find(atom.value());
+        }
+        return nullptr;
+    }
+
+    auto Map::set(const Atom &key,
+                  const Value &value) noexcept -> void
+    {
+        impl().map.set(key, value);
+    }
+
+    auto Map::set(const Atom &key,
+                  Value &&value) noexcept -> void
+    {
+        impl().map.set(key, std::move(value));
+    }
+
+    auto Map::erase(const Atom &key) noexcept -> void
+    {
+        impl().map.erase(key);
+    }
+
+    auto Map::contains(const Atom &key) const noexcept -> bool
+    {
+        return impl().map.find(key) != nullptr;
+    }
+
+    auto Map::find(const Atom &key) const noexcept -> const Value *
     {
         if (const auto *value_ptr = impl().map.find(key); value_ptr)
         {
@@ -120,6 +178,50 @@ namespace traeger
         return nullptr;
     }
 
+    auto Map::set_range(std::vector<std::pair<Atom, Value>> &&pairs) noexcept -> void
+    {
+        auto &map = impl().map;
+        for (auto &[key, value] : pairs)
+        {
+            map.set(std::move(key), std::move(value));
+        }
+    }
+
+    auto Map::set_range(std::vector<std::pair<String, Value>> &&pairs) noexcept -> void
+    {
+        auto &map = impl().map;
+        for (auto &[key, value] : pairs)
+        {
+            map.set(Atom{key}, std::move(value));
+        }
+    }
+
+    auto Map::from_pairs(std::vector<std::pair<Atom, Value>> &&pairs) noexcept -> Map
+    {
+        Map map;
+        map.set_range(std::move(pairs));
+        return map;
+    }
+
+    auto Map::from_pairs(std::vector<std::pair<String, Value>> &&pairs) noexcept -> Map
+    {
+        Map map;
+        map.set_range(std::move(pairs));
+        return map;
+    }
+
+    auto Map::from_generator(const std::function<bool(std::pair<Atom, Value> &)> &generator) -> Map
+    {
+        Map map;
+        auto &transient = map.impl().map;
+        auto pair = std::pair<Atom, Value>{};
+        while (generator(pair))
+        {
+            transient.set(std::move(pair.first), std::move(pair.second));
+        }
+        return map;
+    }
+
     auto Map::empty() const noexcept -> bool
     {
         return impl().map.empty();
@@ -130,6 +232,34 @@ namespace traeger
         return impl().map.size();
     }
 
+    auto Map::get_in(const List &path) const noexcept -> const Value *
+    {
+        const auto &steps = path.impl().list;
+        if (steps.empty())
+        {
+            return nullptr;
+        }
+        return Value::impl_type::find_in(impl().map, steps.begin(), steps.end());
+    }
+
+    auto Map::set_in(const List &path,
+                      const Value &value) noexcept -> bool
+    {
+        return update_in(path, [&value](const Value &)
+                         { return value; });
+    }
+
+    auto Map::update_in(const List &path,
+                         const Update &update) noexcept -> bool
+    {
+        const auto &steps = path.impl().list;
+        if (steps.empty())
+        {
+            return false;
+        }
+        return Value::impl_type::update_in(impl().map, steps.begin(), steps.end(), update);
+    }
+
     Map::Iterator::impl_type::impl_type(const iterator_type &begin, const iterator_type &end) noexcept
         : begin(begin),
           end(end)
@@ -146,6 +276,11 @@ namespace traeger
         new (impl_) impl_type{map.impl().map.begin(), map.impl().map.end()};
     }
 
+    Map::Iterator::Iterator(impl_type &&other_impl) noexcept
+    {
+        new (impl_) impl_type{std::move(other_impl)};
+    }
+
     Map::Iterator::operator bool() const noexcept
     {
         return impl().begin != impl().end;
@@ -153,7 +288,7 @@ namespace traeger
 
     auto Map::Iterator::key() const noexcept -> const String &
     {
-        return impl().begin->first;
+        return impl().begin->first.str();
     }
 
     auto Map::Iterator::value() const noexcept -> const Value &
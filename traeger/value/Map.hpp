@@ -3,9 +3,12 @@
 #pragma once
 
 #include <cstddef>
+#include <functional>
 #include <utility>
+#include <vector>
 
 #include <traeger/value/Types.hpp>
+#include <traeger/value/Atom.hpp>
 
 namespace traeger
 {
@@ -55,10 +58,67 @@ namespace traeger
 
         auto find(const String &key) const noexcept -> const Value *;
 
+        auto set(const Atom &key,
+                 const Value &value) noexcept -> void;
+
+        auto set(const Atom &key,
+                 Value &&value) noexcept -> void;
+
+        auto erase(const Atom &key) noexcept -> void;
+
+        auto contains(const Atom &key) const noexcept -> bool;
+
+        auto find(const Atom &key) const noexcept -> const Value *;
+
+        // The pairs are set in a single pass over the transient instead of
+        // one out of line set per key, later pairs win over earlier ones.
+        auto set_range(std::vector<std::pair<Atom, Value>> &&pairs) noexcept -> void;
+
+        auto set_range(std::vector<std::pair<String, Value>> &&pairs) noexcept -> void;
+
+        static auto from_pairs(std::vector<std::pair<Atom, Value>> &&pairs) noexcept -> Map;
+
+        static auto from_pairs(std::vector<std::pair<String, Value>> &&pairs) noexcept -> Map;
+
+        // The generator stores the next pair and returns true until the
+        // pairs run out, they are set in a single pass over the transient.
+        static auto from_generator(const std::function<bool(std::pair<Atom, Value> &)> &generator) -> Map;
+
+        // Builds the map from transform applied to every element of the
+        // range, transform returns the key and the value of each pair.
+        template <typename Iterator, typename Sentinel, typename Transform>
+        static auto from_pairs(Iterator first,
+                               const Sentinel last,
+                               Transform &&transform) -> Map
+        {
+            return from_generator(
+                [&first, &last, &transform](std::pair<Atom, Value> &pair) -> bool
+                {
+                    if (first == last)
+                    {
+                        return false;
+                    }
+                    pair = transform(*first);
+                    ++first;
+                    return true;
+                });
+        }
+
         auto empty() const noexcept -> bool;
 
         auto size() const noexcept -> std::size_t;
 
+        // A path is a list of map keys and list indices. The updates copy
+        // only the nodes along the path and leave the map untouched when the
+        // path does not exist, the last key of a path may be a new one.
+        auto get_in(const List &path) const noexcept -> const Value *;
+
+        auto set_in(const List &path,
+                    const Value &value) noexcept -> bool;
+
+        auto update_in(const List &path,
+                       const Update &update) noexcept -> bool;
+
         template <typename... Args>
         auto set(const String &key, const Value &value, Args &&...args) noexcept -> void
         {
@@ -103,6 +163,8 @@ namespace traeger
 
             explicit Iterator(const Map &map) noexcept;
 
+            explicit Iterator(impl_type &&other_impl) noexcept;
+
             explicit operator bool() const noexcept;
             auto operator!=(bool end) const noexcept -> bool;
             auto operator==(bool end) const noexcept -> bool;
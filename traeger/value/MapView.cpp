@@ -0,0 +1,67 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include "traeger/value/MapView.hpp"
+#include "traeger/value/Value_impl.hpp"
+
+namespace traeger
+{
+    MapView::MapView(const Value &value) noexcept
+        : value_(&value)
+    {
+    }
+
+    auto MapView::contains(const String &key) const noexcept -> bool
+    {
+        const auto atom = Atom::find(key);
+        return atom && contains(atom.value());
+    }
+
+    auto MapView::find(const String &key) const noexcept -> const Value *
+    {
+        if (const auto atom = Atom::find(key); atom)
+        {
+            return find(atom.value());
+        }
+        return nullptr;
+    }
+
+    auto MapView::contains(const Atom &key) const noexcept -> bool
+    {
+        return value_->impl().get_map()->find(key) != nullptr;
+    }
+
+    auto MapView::find(const Atom &key) const noexcept -> const Value *
+    {
+        if (const auto *value_ptr = value_->impl().get_map()->find(key); value_ptr)
+        {
+            return &value_ptr->get();
+        }
+        return nullptr;
+    }
+
+    auto MapView::empty() const noexcept -> bool
+    {
+        return value_->impl().get_map()->empty();
+    }
+
+    auto MapView::size() const noexcept -> std::size_t
+    {
+        return value_->impl().get_map()->size();
+    }
+
+    auto MapView::map() const noexcept -> Map
+    {
+        return Map{Map::impl_type{*value_->impl().get_map()}};
+    }
+
+    auto MapView::begin() const noexcept -> Map::Iterator
+    {
+        const auto &map = *value_->impl().get_map();
+        return Map::Iterator{Map::Iterator::impl_type{map.begin(), map.end()}};
+    }
+
+    auto MapView::end() noexcept -> bool
+    {
+        return false;
+    }
+}
@@ -0,0 +1,53 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <cstddef>
+
+#include <traeger/value/Types.hpp>
+#include <traeger/value/Atom.hpp>
+#include <traeger/value/Map.hpp>
+
+namespace traeger
+{
+    // A read only view of the map held by a Value. It borrows the value
+    // instead of building a Map from it, so it is valid only as long as
+    // the value is neither modified nor destroyed.
+    struct MapView
+    {
+        auto contains(const String &key) const noexcept -> bool;
+
+        auto find(const String &key) const noexcept -> const Value *;
+
+        auto contains(const Atom &key) const noexcept -> bool;
+
+        auto find(const Atom &key) const noexcept -> const Value *;
+
+        auto empty() const noexcept -> bool;
+
+        auto size() const noexcept -> std::size_t;
+
+        auto map() const noexcept -> Map;
+
+        auto begin() const noexcept -> Map::Iterator;
+
+        static auto end() noexcept -> bool;
+
+    private:
+        friend struct Value;
+
+        explicit MapView(const Value &value) noexcept;
+
+        const Value *value_;
+    };
+}
+
+inline auto begin(const traeger::MapView &view) -> traeger::Map::Iterator
+{
+    return view.begin();
+}
+
+inline auto end(const traeger::MapView &) -> bool
+{
+    return traeger::MapView::end();
+}
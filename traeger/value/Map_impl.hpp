@@ -2,20 +2,73 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <utility>
+
 #include <immer/box.hpp>
 #include <immer/map.hpp>
 #include <immer/map_transient.hpp>
 
 #include "traeger/value/Map.hpp"
+#include "traeger/value/Value.hpp"
+#include "traeger/value/Memory_impl.hpp"
 
 namespace traeger
 {
     struct Map::impl_type
     {
-        using key_type = String;
-        using value_type = immer::box<Value>;
-        using persistent_type = immer::map<key_type, value_type>;
-        using transient_type = immer::map_transient<key_type, value_type>;
+        // The boxed values of a map never change, so each box keeps the hash
+        // of its value once computed and hashing the map again does not walk
+        // into the values.
+        struct entry_type : Value
+        {
+            ~entry_type() noexcept = default;
+
+            entry_type() noexcept = default;
+
+            entry_type(const Value &value) noexcept
+                : Value(value)
+            {
+            }
+
+            entry_type(Value &&value) noexcept
+                : Value(std::move(value))
+            {
+            }
+
+            entry_type(const entry_type &other) noexcept
+                : Value(other),
+                  hash_(other.hash_.load(std::memory_order_relaxed))
+            {
+            }
+
+            entry_type(entry_type &&other) noexcept
+                : Value(std::move(other)),
+                  hash_(other.hash_.load(std::memory_order_relaxed))
+            {
+            }
+
+            auto hash() const noexcept -> std::size_t
+            {
+                auto hash = hash_.load(std::memory_order_relaxed);
+                if (hash == 0)
+                {
+                    hash = Value::hash();
+                    hash_.store(hash, std::memory_order_relaxed);
+                }
+                return hash;
+            }
+
+        private:
+            mutable std::atomic<std::size_t> hash_{0};
+        };
+
+        using key_type = Atom;
+        using value_type = immer::box<entry_type, memory_policy>;
+        using persistent_type = immer::map<key_type, value_type, std::hash<key_type>, std::equal_to<key_type>, memory_policy>;
+        using transient_type = immer::map_transient<key_type, value_type, std::hash<key_type>, std::equal_to<key_type>, memory_policy>;
 
         ~impl_type() noexcept = default;
 
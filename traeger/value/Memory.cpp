@@ -0,0 +1,218 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <array>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <utility>
+
+#include "traeger/value/Memory_impl.hpp"
+
+namespace
+{
+    constexpr std::size_t granularity = 64;
+
+    constexpr std::size_t classes_count = 64;
+
+    // Each thread holds two magazines per size class, so it keeps up to
+    // TRAEGER_VALUE_FREE_LIST_SIZE blocks of a class.
+    constexpr std::size_t magazine_size = TRAEGER_VALUE_FREE_LIST_SIZE / 2;
+
+    constexpr std::size_t max_shared_magazines = 16;
+
+    static_assert(magazine_size > 0);
+
+    struct block_type
+    {
+        block_type *next;
+        block_type *next_magazine;
+    };
+
+    struct magazine_type
+    {
+        block_type *head = nullptr;
+        std::size_t count = 0;
+
+        auto pop() noexcept -> block_type *
+        {
+            auto *block = head;
+            head = block->next;
+            --count;
+            return block;
+        }
+
+        auto push(void *data) noexcept -> void
+        {
+            head = new (data) block_type{head, nullptr};
+            ++count;
+        }
+
+        auto clear() noexcept -> void
+        {
+            while (head != nullptr)
+            {
+                ::operator delete(pop());
+            }
+        }
+    };
+
+    // Only full magazines go to the shared pool, so the lock is taken once
+    // per magazine and never to walk a list.
+    struct shared_pool_type
+    {
+        std::mutex mutex;
+        block_type *magazines = nullptr;
+        std::size_t count = 0;
+    };
+
+    // Never destroyed, the blocks released by static destructors still have
+    // a place to go.
+    auto shared_pools() noexcept -> std::array<shared_pool_type, classes_count> &
+    {
+        static auto &pools = *new std::array<shared_pool_type, classes_count>{};
+        return pools;
+    }
+
+    auto push_magazine(const std::size_t index,
+                       magazine_type &magazine) noexcept -> bool
+    {
+        auto &shared = shared_pools()[index];
+        std::unique_lock lock{shared.mutex};
+        if (shared.count == max_shared_magazines)
+        {
+            return false;
+        }
+        magazine.head->next_magazine = shared.magazines;
+        shared.magazines = std::exchange(magazine.head, nullptr);
+        magazine.count = 0;
+        ++shared.count;
+        return true;
+    }
+
+    auto pop_magazine(const std::size_t index,
+                      magazine_type &magazine) noexcept -> bool
+    {
+        auto &shared = shared_pools()[index];
+        std::unique_lock lock{shared.mutex};
+        auto *head = shared.magazines;
+        if (head == nullptr)
+        {
+            return false;
+        }
+        shared.magazines = head->next_magazine;
+        --shared.count;
+        magazine = {head, magazine_size};
+        return true;
+    }
+
+    // Set once the cache of the thread is destroyed, so the blocks released
+    // by other thread-local destructors go straight to the heap.
+    thread_local bool cache_destroyed = false;
+
+    struct class_cache_type
+    {
+        magazine_type loaded;
+        magazine_type previous;
+    };
+
+    // The full magazines of a thread that ends go to the shared pool, they
+    // often hold the blocks a worker released for the other threads.
+    struct cache_type
+    {
+        ~cache_type() noexcept
+        {
+            cache_destroyed = true;
+            for (std::size_t index = 0; index < classes_count; ++index)
+            {
+                for (auto *magazine : {&classes[index].loaded, &classes[index].previous})
+                {
+                    if (magazine->count != magazine_size || !push_magazine(index, *magazine))
+                    {
+                        magazine->clear();
+                    }
+                }
+            }
+        }
+
+        std::array<class_cache_type, classes_count> classes;
+    };
+
+    thread_local cache_type cache;
+
+    auto size_class(const std::size_t size) noexcept -> std::size_t
+    {
+        return (size + granularity - 1) / granularity - 1;
+    }
+
+    auto is_pooled(const std::size_t size) noexcept -> bool
+    {
+        return size != 0 && size <= granularity * classes_count;
+    }
+}
+
+namespace traeger
+{
+    auto pool_heap::allocate_block(const std::size_t size) noexcept -> void *
+    {
+        if (!is_pooled(size))
+        {
+            return ::operator new(size);
+        }
+        // Rounded up even without a cache, another thread may put the block
+        // in the magazines of its class.
+        const auto index = size_class(size);
+        if (cache_destroyed)
+        {
+            return ::operator new((index + 1) * granularity);
+        }
+        auto &[loaded, previous] = cache.classes[index];
+        if (loaded.count == 0)
+        {
+            if (previous.count != 0)
+            {
+                std::swap(loaded, previous);
+            }
+            else if (!pop_magazine(index, loaded))
+            {
+                return ::operator new((index + 1) * granularity);
+            }
+        }
+        return loaded.pop();
+    }
+
+    auto pool_heap::deallocate_block(const std::size_t size,
+                                     void *data) noexcept -> void
+    {
+        if (data == nullptr)
+        {
+            return;
+        }
+        if (!is_pooled(size) || cache_destroyed)
+        {
+            ::operator delete(data);
+            return;
+        }
+        const auto index = size_class(size);
+        auto &[loaded, previous] = cache.classes[index];
+        if (loaded.count == magazine_size)
+        {
+            if (previous.count != 0 && !push_magazine(index, previous))
+            {
+                ::operator delete(data);
+                return;
+            }
+            std::swap(loaded, previous);
+        }
+        loaded.push(data);
+    }
+
+    auto pool_heap::cached_blocks(const std::size_t size) noexcept -> std::size_t
+    {
+        if (!is_pooled(size) || cache_destroyed)
+        {
+            return 0;
+        }
+        const auto &[loaded, previous] = cache.classes[size_class(size)];
+        return loaded.count + previous.count;
+    }
+}
@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+
+#include <cstddef>
+
+#include <immer/heap/cpp_heap.hpp>
+#include <immer/heap/heap_policy.hpp>
+#include <immer/heap/malloc_heap.hpp>
+#include <immer/memory_policy.hpp>
+
+#ifndef TRAEGER_VALUE_FREE_LIST_SIZE
+#define TRAEGER_VALUE_FREE_LIST_SIZE 1024
+#endif
+
+namespace traeger
+{
+    // Blocks in size classes of 64 bytes up to 4 KiB. Each thread keeps up
+    // to TRAEGER_VALUE_FREE_LIST_SIZE blocks of a class, and once full gives
+    // the older half to a shared pool in a single batch. A thread that runs
+    // out takes a whole batch back, so the blocks released by another thread
+    // than the one that made them, as values sent to actors, are still
+    // reused. It backs both the pool memory policy and traeger::Pool.
+    struct pool_heap
+    {
+        template <typename... Tags>
+        static auto allocate(const std::size_t size,
+                             Tags...) noexcept -> void *
+        {
+            return allocate_block(size);
+        }
+
+        template <typename... Tags>
+        static auto deallocate(const std::size_t size,
+                               void *data,
+                               Tags...) noexcept -> void
+        {
+            deallocate_block(size, data);
+        }
+
+        static auto allocate_block(std::size_t size) noexcept -> void *;
+
+        static auto deallocate_block(std::size_t size,
+                                     void *data) noexcept -> void;
+
+        // The blocks of the size class of size kept by the calling thread.
+        static auto cached_blocks(std::size_t size) noexcept -> std::size_t;
+    };
+
+    // The memory policy of every immer structure behind List, Map, Array and
+    // Value, selected at build time with TRAEGER_VALUE_MEMORY_POLICY.
+#if defined(TRAEGER_VALUE_MEMORY_POLICY_MALLOC)
+    // Every node goes straight to malloc, useful with a pooling allocator
+    // such as jemalloc or mimalloc preloaded.
+    using memory_policy = immer::memory_policy<immer::heap_policy<immer::malloc_heap>,
+                                               immer::refcount_policy,
+                                               immer::spinlock_policy>;
+#elif defined(TRAEGER_VALUE_MEMORY_POLICY_POOL)
+    using memory_policy = immer::memory_policy<immer::heap_policy<pool_heap>,
+                                               immer::refcount_policy,
+                                               immer::spinlock_policy>;
+#elif defined(TRAEGER_VALUE_MEMORY_POLICY_FREE_LIST)
+    // The free lists of immer, the same as the default policy but for the
+    // number of nodes they keep, TRAEGER_VALUE_FREE_LIST_SIZE.
+    using memory_policy = immer::memory_policy<immer::free_list_heap_policy<immer::cpp_heap, TRAEGER_VALUE_FREE_LIST_SIZE>,
+                                               immer::refcount_policy,
+                                               immer::spinlock_policy>;
+#else
+    using memory_policy = immer::default_memory_policy;
+#endif
+
+    // The policy of LocalList and LocalMap, their nodes never leave the
+    // thread that created them so the reference counts need no atomics.
+    using local_memory_policy = immer::memory_policy<memory_policy::heap,
+                                                     immer::unsafe_refcount_policy,
+                                                     immer::no_lock_policy>;
+}
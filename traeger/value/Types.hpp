@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include <functional>
 #include <string>
 
 #include <traeger/value/types.h>
@@ -14,9 +15,22 @@ namespace traeger
     using UInt = traeger_uint_t;
     using Float = traeger_float_t;
     using String = std::string;
+    struct Blob;
+    template <typename Element>
+    struct Array;
+    using FloatArray = Array<Float>;
+    using IntArray = Array<Int>;
     struct List;
+    struct ListView;
+    struct LocalList;
+    struct LocalMap;
     struct Map;
+    struct MapView;
     struct Value;
+    using Update = std::function<Value(const Value &)>;
+
+    template <typename Object, typename Enable = void>
+    struct Convert;
 }
 
 struct traeger_string_t final : traeger::String
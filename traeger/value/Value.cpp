@@ -6,6 +6,10 @@
 #include <utility>
 #include <ios>
 #include <optional>
+#include <new>
+#include <string_view>
+#include <functional>
+#include <iterator>
 
 #include "traeger/value/Value.hpp"
 #include "traeger/value/Value_impl.hpp"
@@ -23,7 +27,26 @@ namespace
     template <class... Types>
     overload(Types...) -> overload<Types...>;
 
-    auto string_to_bool(const String &str) -> std::optional<Bool>
+    auto hash_combine(const std::size_t seed,
+                      const std::size_t hash) noexcept -> std::size_t
+    {
+        return seed ^ (hash + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+    }
+
+    template <typename Sequence, typename Hash>
+    auto hash_sequence(const std::size_t seed,
+                       const Sequence &sequence,
+                       Hash &&hash) noexcept -> std::size_t
+    {
+        auto result = hash_combine(seed, sequence.size());
+        for (const auto &element : sequence)
+        {
+            result = hash_combine(result, hash(element));
+        }
+        return result;
+    }
+
+    auto string_to_bool(const std::string_view str) -> std::optional<Bool>
     {
         if (str == "true")
         {
@@ -36,23 +59,29 @@ namespace
         return std::nullopt;
     }
 
-    auto string_to_int(const String &str) -> std::optional<Int>
+    auto string_to_int(const std::string_view str) -> std::optional<Int>
     {
-        std::size_t pos = 0;
-        const auto result = std::stol(str, &pos);
-        if (pos == str.size())
+        try
+        {
+            std::size_t pos = 0;
+            const auto result = std::stol(String{str}, &pos);
+            if (pos == str.size())
+            {
+                return {result};
+            }
+        }
+        catch (...)
         {
-            return {result};
         }
         return std::nullopt;
     }
 
-    auto string_to_uint(const String &str) -> std::optional<UInt>
+    auto string_to_uint(const std::string_view str) -> std::optional<UInt>
     {
         try
         {
             std::size_t pos = 0;
-            const auto result = std::stoul(str, &pos);
+            const auto result = std::stoul(String{str}, &pos);
             if (pos == str.size())
             {
                 return {result};
@@ -64,12 +93,12 @@ namespace
         return std::nullopt;
     }
 
-    auto string_to_float(const String &str) -> std::optional<Float>
+    auto string_to_float(const std::string_view str) -> std::optional<Float>
     {
         try
         {
             std::size_t pos = 0;
-            const auto result = std::stod(str, &pos);
+            const auto result = std::stod(String{str}, &pos);
             if (pos == str.size())
             {
                 return {result};
@@ -80,10 +109,207 @@ namespace
         }
         return std::nullopt;
     }
+
+    using path_iterator = Value::impl_type::path_iterator;
+
+    // Looks the key up without interning it, paths may come from untrusted
+    // input and only the keys that get stored are interned.
+    auto path_key(const Value &step) noexcept -> std::optional<Atom>
+    {
+        if (const auto *string = step.impl().get_string(); string)
+        {
+            return Atom::find(string->view());
+        }
+        return std::nullopt;
+    }
+
+    auto path_position(const Value &step,
+                       const std::size_t size) noexcept -> std::optional<std::size_t>
+    {
+        Int index;
+        switch (step.type())
+        {
+        case Value::Type::Int:
+            index = std::get<Int>(step.impl().variant);
+            break;
+        case Value::Type::UInt:
+            index = static_cast<Int>(std::get<UInt>(step.impl().variant));
+            break;
+        default:
+            return std::nullopt;
+        }
+        if (const std::size_t position = index < 0 ? index + size : index; position < size)
+        {
+            return position;
+        }
+        return std::nullopt;
+    }
+
+    auto store(Value::impl_type::map_type &map,
+               const Atom &key,
+               Value &&value) noexcept -> void
+    {
+        map = std::move(map).set(key, std::move(value));
+    }
+
+    auto store(Map::impl_type::transient_type &map,
+               const Atom &key,
+               Value &&value) noexcept -> void
+    {
+        map.set(key, std::move(value));
+    }
+
+    auto store(Value::impl_type::list_type &list,
+               const std::size_t position,
+               Value &&value) noexcept -> void
+    {
+        list = std::move(list).set(position, std::move(value));
+    }
+
+    auto store(List::impl_type::transient_type &list,
+               const std::size_t position,
+               Value &&value) noexcept -> void
+    {
+        list.set(position, std::move(value));
+    }
+
+    template <typename MapType>
+    auto map_find_in(const MapType &map,
+                     const path_iterator first,
+                     const path_iterator last) noexcept -> const Value *
+    {
+        if (const auto key = path_key(*first); key)
+        {
+            if (const auto *box = map.find(key.value()); box)
+            {
+                return Value::impl_type::find_in(box->get(), std::next(first), last);
+            }
+        }
+        return nullptr;
+    }
+
+    template <typename ListType>
+    auto list_find_in(const ListType &list,
+                      const path_iterator first,
+                      const path_iterator last) noexcept -> const Value *
+    {
+        if (const auto position = path_position(*first, list.size()); position)
+        {
+            return Value::impl_type::find_in(list[position.value()], std::next(first), last);
+        }
+        return nullptr;
+    }
+
+    // The value on the path is copied out, updated and stored back, so
+    // every level is rebuilt only once and only when the update succeeds.
+    template <typename MapType>
+    auto map_update_in(MapType &map,
+                       const path_iterator first,
+                       const path_iterator last,
+                       const Update &update) noexcept -> bool
+    {
+        const auto *string = first->impl().get_string();
+        if (!string)
+        {
+            return false;
+        }
+        const auto key = path_key(*first);
+        const auto *box = key ? map.find(key.value()) : nullptr;
+        const auto next = std::next(first);
+        if (next == last)
+        {
+            store(map, key ? key.value() : Atom{string->view()}, update(box ? static_cast<const Value &>(box->get()) : Value{}));
+            return true;
+        }
+        if (!box)
+        {
+            return false;
+        }
+        auto value = box->get();
+        if (!Value::impl_type::update_in(value, next, last, update))
+        {
+            return false;
+        }
+        store(map, key.value(), std::move(value));
+        return true;
+    }
+
+    template <typename ListType>
+    auto list_update_in(ListType &list,
+                        const path_iterator first,
+                        const path_iterator last,
+                        const Update &update) noexcept -> bool
+    {
+        const auto position = path_position(*first, list.size());
+        if (!position)
+        {
+            return false;
+        }
+        auto value = list[position.value()];
+        if (!Value::impl_type::update_in(value, std::next(first), last, update))
+        {
+            return false;
+        }
+        store(list, position.value(), std::move(value));
+        return true;
+    }
 }
 
 namespace traeger
 {
+    Value::impl_type::string_type::string_type(const std::string_view view) noexcept
+    {
+        if (view.size() <= capacity)
+        {
+            std::memcpy(bytes_, view.data(), view.size());
+            bytes_[capacity] = static_cast<char>(view.size());
+            return;
+        }
+        auto *block = static_cast<heap_type *>(::operator new(sizeof(heap_type) + view.size()));
+        new (block) heap_type{{1}, view.size(), {0}};
+        std::memcpy(reinterpret_cast<char *>(block + 1), view.data(), view.size());
+        std::memcpy(bytes_, &block, sizeof(block));
+        bytes_[capacity] = static_cast<char>(heap_tag);
+    }
+
+    Value::impl_type::string_type::string_type(const string_type &other) noexcept
+    {
+        std::memcpy(bytes_, other.bytes_, sizeof(bytes_));
+        if (!is_inline())
+        {
+            heap()->count.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    auto Value::impl_type::string_type::release() noexcept -> void
+    {
+        if (!is_inline())
+        {
+            if (auto *block = heap(); block->count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                block->~heap_type();
+                ::operator delete(block);
+            }
+            bytes_[capacity] = 0;
+        }
+    }
+
+    auto Value::impl_type::string_type::hash() const noexcept -> std::size_t
+    {
+        if (is_inline())
+        {
+            return std::hash<std::string_view>{}(view());
+        }
+        auto *block = heap();
+        auto hash = block->hash.load(std::memory_order_relaxed);
+        if (hash == 0)
+        {
+            hash = std::hash<std::string_view>{}(view());
+            block->hash.store(hash, std::memory_order_relaxed);
+        }
+        return hash;
+    }
+
     Value::impl_type::impl_type() noexcept
         : variant()
     {
@@ -114,6 +340,102 @@ namespace traeger
         return std::get_if<string_type>(&variant);
     }
 
+    auto Value::impl_type::identity_equals(const impl_type &other) const noexcept -> bool
+    {
+        if (variant.index() != other.variant.index())
+        {
+            return false;
+        }
+        if (const auto *list = get_list(); list)
+        {
+            return list->identity_equals(*other.get_list());
+        }
+        if (const auto *map = get_map(); map)
+        {
+            return map->identity_equals(*other.get_map());
+        }
+        if (const auto *array = std::get_if<float_array_type>(&variant); array)
+        {
+            return array->identity_equals(std::get<float_array_type>(other.variant));
+        }
+        if (const auto *array = std::get_if<int_array_type>(&variant); array)
+        {
+            return array->identity_equals(std::get<int_array_type>(other.variant));
+        }
+        return false;
+    }
+
+    auto Value::impl_type::find_in(const Value &value,
+                                   const path_iterator first,
+                                   const path_iterator last) noexcept -> const Value *
+    {
+        if (first == last)
+        {
+            return &value;
+        }
+        if (const auto *map = value.impl().get_map(); map)
+        {
+            return map_find_in(*map, first, last);
+        }
+        if (const auto *list = value.impl().get_list(); list)
+        {
+            return list_find_in(*list, first, last);
+        }
+        return nullptr;
+    }
+
+    auto Value::impl_type::find_in(const Map::impl_type::transient_type &map,
+                                   const path_iterator first,
+                                   const path_iterator last) noexcept -> const Value *
+    {
+        return map_find_in(map, first, last);
+    }
+
+    auto Value::impl_type::find_in(const List::impl_type::transient_type &list,
+                                   const path_iterator first,
+                                   const path_iterator last) noexcept -> const Value *
+    {
+        return list_find_in(list, first, last);
+    }
+
+    auto Value::impl_type::update_in(Value &value,
+                                     const path_iterator first,
+                                     const path_iterator last,
+                                     const Update &update) noexcept -> bool
+    {
+        if (first == last)
+        {
+            value = update(value);
+            return true;
+        }
+        auto &variant = value.impl().variant;
+        if (auto *map = std::get_if<map_type>(&variant); map)
+        {
+            return map_update_in(*map, first, last, update);
+        }
+        if (auto *list = std::get_if<list_type>(&variant); list)
+        {
+            return list_update_in(*list, first, last, update);
+        }
+        return false;
+    }
+
+    auto Value::impl_type::update_in(Map::impl_type::transient_type &map,
+                                     const path_iterator first,
+                                     const path_iterator last,
+                                     const Update &update) noexcept -> bool
+    {
+        return map_update_in(map, first, last, update);
+    }
+
+    auto Value::impl_type::update_in(List::impl_type::transient_type &list,
+                                     const path_iterator first,
+                                     const path_iterator last,
+                                     const Update &update) noexcept -> bool
+    {
+        return list_update_in(list, first, last, update);
+    }
+
     Value::~Value() noexcept
     {
         impl().~impl_type();
@@ -195,7 +517,7 @@ namespace traeger
     Value::Value(String &&variant) noexcept
         : Value()
     {
-        impl().variant.emplace<impl_type::string_type>(std::move(variant));
+        impl().variant.emplace<impl_type::string_type>(variant);
     }
 
     Value::Value(const char *variant) noexcept
@@ -228,6 +550,42 @@ namespace traeger
         impl().variant.emplace<impl_type::map_type>(std::move(variant.impl()).persistent());
     }
 
+    Value::Value(const Blob &variant) noexcept
+        : Value()
+    {
+        impl().variant.emplace<Blob>(variant);
+    }
+
+    Value::Value(Blob &&variant) noexcept
+        : Value()
+    {
+        impl().variant.emplace<Blob>(std::move(variant));
+    }
+
+    Value::Value(const FloatArray &variant) noexcept
+        : Value()
+    {
+        impl().variant.emplace<impl_type::float_array_type>(variant.impl().persistent());
+    }
+
+    Value::Value(FloatArray &&variant) noexcept
+        : Value()
+    {
+        impl().variant.emplace<impl_type::float_array_type>(std::move(variant.impl()).persistent());
+    }
+
+    Value::Value(const IntArray &variant) noexcept
+        : Value()
+    {
+        impl().variant.emplace<impl_type::int_array_type>(variant.impl().persistent());
+    }
+
+    Value::Value(IntArray &&variant) noexcept
+        : Value()
+    {
+        impl().variant.emplace<impl_type::int_array_type>(std::move(variant.impl()).persistent());
+    }
+
     auto Value::operator=(const Value &other) noexcept -> Value &
     {
         if (this != &other)
@@ -246,12 +604,49 @@ namespace traeger
 
     auto Value::operator==(const Value &other) const noexcept -> bool
     {
-        return impl().variant == other.impl().variant;
+        return impl().identity_equals(other.impl()) ||
+               impl().variant == other.impl().variant;
     }
 
     auto Value::operator!=(const Value &other) const noexcept -> bool
     {
-        return impl().variant != other.impl().variant;
+        return !(*this == other);
+    }
+
+    auto Value::hash() const noexcept -> std::size_t
+    {
+        const auto seed = impl().variant.index();
+        return std::visit(
+            overload{
+                [seed](Null)
+                { return seed; },
+                [seed](const auto scalar)
+                { return hash_combine(seed, std::hash<std::decay_t<decltype(scalar)>>{}(scalar)); },
+                [seed](const Value::impl_type::string_type &string)
+                { return hash_combine(seed, string.hash()); },
+                [seed](const Value::impl_type::list_type &values)
+                { return hash_sequence(seed, values, [](const Value &value)
+                                       { return value.hash(); }); },
+                [seed](const Value::impl_type::map_type &values)
+                {
+                    // The order of iteration of a map is not part of its
+                    // identity, so the entries are combined commutatively.
+                    // The hash of each value is kept in its box.
+                    auto result = hash_combine(seed, values.size());
+                    for (const auto &[key, value] : values)
+                    {
+                        result += hash_combine(key.hash(), value.get().hash());
+                    }
+                    return result;
+                },
+                [seed](const Blob &blob)
+                { return hash_combine(seed, std::hash<std::string_view>{}(blob.view())); },
+                [seed](const Value::impl_type::float_array_type &array)
+                { return hash_sequence(seed, array, std::hash<Float>{}); },
+                [seed](const Value::impl_type::int_array_type &array)
+                { return hash_sequence(seed, array, std::hash<Int>{}); },
+            },
+            impl().variant);
     }
 
     auto Value::type() const noexcept -> Type
@@ -280,7 +675,7 @@ namespace traeger
         case Type::Bool:
             return std::get<Bool>(impl().variant);
         case Type::String:
-            return string_to_bool(impl().get_string()->get());
+            return string_to_bool(impl().get_string()->view());
         default:
             break;
         }
@@ -294,7 +689,7 @@ namespace traeger
         case Type::Int:
             return std::get<Int>(impl().variant);
         case Type::String:
-            return string_to_int(impl().get_string()->get());
+            return string_to_int(impl().get_string()->view());
         default:
             break;
         }
@@ -317,7 +712,7 @@ namespace traeger
         case Type::UInt:
             return std::get<UInt>(impl().variant);
         case Type::String:
-            return string_to_uint(impl().get_string()->get());
+            return string_to_uint(impl().get_string()->view());
         default:
             break;
         }
@@ -335,20 +730,20 @@ namespace traeger
         case Type::Float:
             return std::get<Float>(impl().variant);
         case Type::String:
-            return string_to_float(impl().get_string()->get());
+            return string_to_float(impl().get_string()->view());
         default:
             break;
         }
         return std::nullopt;
     }
 
-    auto Value::get_string() const noexcept -> const String *
+    auto Value::get_string() const noexcept -> std::optional<std::string_view>
     {
         if (type() == Type::String)
         {
-            return &impl().get_string()->get();
+            return impl().get_string()->view();
         }
-        return nullptr;
+        return std::nullopt;
     }
 
     auto Value::get_list() const noexcept -> std::optional<List>
@@ -369,6 +764,51 @@ namespace traeger
         return std::nullopt;
     }
 
+    auto Value::get_list_view() const & noexcept -> std::optional<ListView>
+    {
+        if (type() == Type::List)
+        {
+            return ListView{*this};
+        }
+        return std::nullopt;
+    }
+
+    auto Value::get_map_view() const & noexcept -> std::optional<MapView>
+    {
+        if (type() == Type::Map)
+        {
+            return MapView{*this};
+        }
+        return std::nullopt;
+    }
+
+    auto Value::get_blob() const noexcept -> std::optional<Blob>
+    {
+        if (const auto *blob = std::get_if<Blob>(&impl().variant); blob)
+        {
+            return *blob;
+        }
+        return std::nullopt;
+    }
+
+    auto Value::get_float_array() const noexcept -> std::optional<FloatArray>
+    {
+        if (const auto *array = std::get_if<impl_type::float_array_type>(&impl().variant); array)
+        {
+            return FloatArray{FloatArray::impl_type{*array}};
+        }
+        return std::nullopt;
+    }
+
+    auto Value::get_int_array() const noexcept -> std::optional<IntArray>
+    {
+        if (const auto *array = std::get_if<impl_type::int_array_type>(&impl().variant); array)
+        {
+            return IntArray{IntArray::impl_type{*array}};
+        }
+        return std::nullopt;
+    }
+
     auto operator<<(std::ostream &os,
                     const Value &value) noexcept -> std::ostream &
     {
@@ -380,12 +820,16 @@ namespace traeger
                 { os << std::boolalpha << variant << std::noboolalpha; },
                 [&os](const Float variant)
                 { os << std::showpoint << variant << std::noshowpoint; },
-                [&os](const Value::impl_type::string_type &boxed)
-                { os << std::quoted(boxed.get()); },
+                [&os](const Value::impl_type::string_type &string)
+                { os << std::quoted(string.view()); },
                 [&os](const Value::impl_type::list_type &values)
                 { os << List{List::impl_type{values}}; },
                 [&os](const Value::impl_type::map_type &values)
                 { os << Map{Map::impl_type{values}}; },
+                [&os](const Value::impl_type::float_array_type &array)
+                { os << FloatArray{FloatArray::impl_type{array}}; },
+                [&os](const Value::impl_type::int_array_type &array)
+                { os << IntArray{IntArray::impl_type{array}}; },
                 [&os](auto variant)
                 { os << variant; }},
             value.impl().variant);
@@ -403,6 +847,9 @@ namespace traeger
             "String",
             "List",
             "Map",
+            "Blob",
+            "FloatArray",
+            "IntArray",
         };
         return types[static_cast<int>(type)];
     }
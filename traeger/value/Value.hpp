@@ -3,29 +3,42 @@
 #pragma once
 
 #include <cstddef>
+#include <functional>
 #include <optional>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <type_traits>
+#include <utility>
 #include <variant>
 
 #include <traeger/value/Types.hpp>
+#include <traeger/value/Array.hpp>
+#include <traeger/value/Blob.hpp>
 #include <traeger/value/List.hpp>
+#include <traeger/value/ListView.hpp>
 #include <traeger/value/Map.hpp>
+#include <traeger/value/MapView.hpp>
 
 namespace traeger
 {
+    template <typename Arg>
+    constexpr auto is_variant_type_v = std::disjunction_v<std::is_same<Arg, Null>,
+                                                          std::is_same<Arg, Bool>,
+                                                          std::is_same<Arg, Int>,
+                                                          std::is_same<Arg, UInt>,
+                                                          std::is_same<Arg, Float>,
+                                                          std::is_same<Arg, String>,
+                                                          std::is_same<Arg, List>,
+                                                          std::is_same<Arg, Map>,
+                                                          std::is_same<Arg, Blob>,
+                                                          std::is_same<Arg, FloatArray>,
+                                                          std::is_same<Arg, IntArray>>;
+
     template <typename Arg>
     auto constexpr assert_is_variant_type() -> void
     {
-        static_assert(std::disjunction_v<std::is_same<Arg, Null>,
-                                         std::is_same<Arg, Bool>,
-                                         std::is_same<Arg, Int>,
-                                         std::is_same<Arg, UInt>,
-                                         std::is_same<Arg, Float>,
-                                         std::is_same<Arg, String>,
-                                         std::is_same<Arg, List>,
-                                         std::is_same<Arg, Map>>);
+        static_assert(is_variant_type_v<Arg>);
     }
 
     struct Value
@@ -52,6 +65,9 @@ namespace traeger
             String = TRAEGER_VALUE_TYPE_STRING,
             List = TRAEGER_VALUE_TYPE_LIST,
             Map = TRAEGER_VALUE_TYPE_MAP,
+            Blob = TRAEGER_VALUE_TYPE_BLOB,
+            FloatArray = TRAEGER_VALUE_TYPE_FLOAT_ARRAY,
+            IntArray = TRAEGER_VALUE_TYPE_INT_ARRAY,
         };
 
         ~Value() noexcept;
@@ -90,6 +106,31 @@ namespace traeger
 
         Value(Map &&variant) noexcept;
 
+        Value(const Blob &variant) noexcept;
+
+        Value(Blob &&variant) noexcept;
+
+        Value(const FloatArray &variant) noexcept;
+
+        Value(FloatArray &&variant) noexcept;
+
+        Value(const IntArray &variant) noexcept;
+
+        Value(IntArray &&variant) noexcept;
+
+        // Local values use non atomic reference counts, they become
+        // values only through an explicit share().
+        Value(const LocalList &variant) = delete;
+
+        Value(const LocalMap &variant) = delete;
+
+        template <typename Object,
+                  typename = decltype(Convert<Object>::to_value(std::declval<const Object &>()))>
+        Value(const Object &object) noexcept
+            : Value(Convert<Object>::to_value(object))
+        {
+        }
+
         auto operator=(const Value &other) noexcept -> Value &;
 
         auto operator=(Value &&other) noexcept -> Value &;
@@ -98,12 +139,18 @@ namespace traeger
 
         auto operator!=(const Value &other) const noexcept -> bool;
 
+        // A structural hash, equal values have equal hashes.
+        auto hash() const noexcept -> std::size_t;
+
         auto type() const noexcept -> Type;
 
         template <typename Arg>
         static constexpr auto type() noexcept -> Type
         {
-            assert_is_variant_type<Arg>();
+            if constexpr (!is_variant_type_v<Arg>)
+            {
+                return Convert<Arg>::type();
+            }
             if constexpr (std::is_same_v<Arg, Null>)
             {
                 return Type::Null;
@@ -136,6 +183,18 @@ namespace traeger
             {
                 return Type::Map;
             }
+            if constexpr (std::is_same_v<Arg, Blob>)
+            {
+                return Type::Blob;
+            }
+            if constexpr (std::is_same_v<Arg, FloatArray>)
+            {
+                return Type::FloatArray;
+            }
+            if constexpr (std::is_same_v<Arg, IntArray>)
+            {
+                return Type::IntArray;
+            }
         }
 
         auto type_name() const noexcept -> const String &;
@@ -145,7 +204,10 @@ namespace traeger
         template <typename Arg>
         constexpr auto get() const noexcept -> std::optional<Arg>
         {
-            assert_is_variant_type<Arg>();
+            if constexpr (!is_variant_type_v<Arg>)
+            {
+                return Convert<Arg>::from_value(*this);
+            }
             if constexpr (std::is_same_v<Arg, Null>)
             {
                 return get_null();
@@ -168,9 +230,9 @@ namespace traeger
             }
             if constexpr (std::is_same_v<Arg, String>)
             {
-                if (const auto *ptr_string = get_string(); ptr_string)
+                if (const auto optional = get_string(); optional)
                 {
-                    return std::optional{*ptr_string};
+                    return std::optional{String{optional.value()}};
                 }
                 return std::nullopt;
             }
@@ -182,6 +244,18 @@ namespace traeger
             {
                 return get_map();
             }
+            if constexpr (std::is_same_v<Arg, Blob>)
+            {
+                return get_blob();
+            }
+            if constexpr (std::is_same_v<Arg, FloatArray>)
+            {
+                return get_float_array();
+            }
+            if constexpr (std::is_same_v<Arg, IntArray>)
+            {
+                return get_int_array();
+            }
         }
 
         auto get_null() const noexcept -> std::optional<Null>;
@@ -194,21 +268,54 @@ namespace traeger
 
         auto get_float() const noexcept -> std::optional<Float>;
 
-        auto get_string() const noexcept -> const String *;
+        auto get_string() const noexcept -> std::optional<std::string_view>;
 
         auto get_list() const noexcept -> std::optional<List>;
 
         auto get_map() const noexcept -> std::optional<Map>;
 
+        // Borrowed views of the list or map held by the value, they are valid
+        // as long as the value is neither modified nor destroyed.
+        auto get_list_view() const & noexcept -> std::optional<ListView>;
+
+        auto get_list_view() const && = delete;
+
+        auto get_map_view() const & noexcept -> std::optional<MapView>;
+
+        auto get_map_view() const && = delete;
+
+        auto get_blob() const noexcept -> std::optional<Blob>;
+
+        auto get_float_array() const noexcept -> std::optional<FloatArray>;
+
+        auto get_int_array() const noexcept -> std::optional<IntArray>;
+
+        using string_layout_type = struct
+        {
+            std::uintptr_t _0;
+            std::uintptr_t _1;
+            std::uintptr_t _2;
+            std::uintptr_t _3;
+        };
+
+        using array_layout_type = struct
+        {
+            std::uintptr_t _0;
+            std::size_t _1;
+        };
+
         using layout_type = std::variant<
             Null,
             Bool,
             Int,
             UInt,
             Float,
-            std::uintptr_t,
+            string_layout_type,
             List::layout_type,
-            Map::layout_type>;
+            Map::layout_type,
+            Blob,
+            array_layout_type,
+            array_layout_type>;
 
     private:
         std::byte impl_[sizeof(layout_type)]{};
@@ -218,13 +325,18 @@ namespace traeger
                     const Value &value) noexcept -> std::ostream &;
 
     template <int Index, typename Arg>
-    auto List::get_index_arg() const -> Arg
+    auto List::get_index_arg(DecodeError &error) const noexcept -> std::optional<Arg>
     {
+        if (error)
+        {
+            return std::nullopt;
+        }
+
         const auto *ptr_value = find(Index);
         if (!ptr_value)
         {
-            throw std::runtime_error(
-                "invalid index in argument " + std::to_string(Index));
+            error = DecodeError{DecodeError::Code::Index, Index};
+            return std::nullopt;
         }
 
         if constexpr (std::is_same_v<Arg, Value>)
@@ -233,15 +345,14 @@ namespace traeger
         }
         else
         {
-            const auto optional = ptr_value->get<Arg>();
+            auto optional = ptr_value->get<Arg>();
             if (!optional)
             {
-                throw std::runtime_error(
-                    "invalid cast in argument " + std::to_string(Index) +
-                    " from type " + ptr_value->type_name() +
-                    " to " + Value::type_name(Value::type<Arg>()));
+                error = DecodeError{DecodeError::Code::Cast, Index, 0, 0,
+                                    &ptr_value->type_name(),
+                                    &Value::type_name(Value::type<Arg>())};
             }
-            return optional.value();
+            return optional;
         }
     }
 
@@ -284,6 +395,15 @@ namespace traeger
     }
 }
 
+template <>
+struct std::hash<traeger::Value>
+{
+    auto operator()(const traeger::Value &value) const noexcept -> std::size_t
+    {
+        return value.hash();
+    }
+};
+
 struct traeger_value_t final : traeger::Value
 {
 };
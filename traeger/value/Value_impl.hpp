@@ -2,7 +2,13 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <string_view>
+
 #include "traeger/value/Value.hpp"
+#include "traeger/value/Array_impl.hpp"
 #include "traeger/value/List_impl.hpp"
 #include "traeger/value/Map_impl.hpp"
 
@@ -10,9 +16,111 @@ namespace traeger
 {
     struct Value::impl_type
     {
-        using string_type = immer::box<String>;
+        // Strings of up to 31 bytes are stored inline, the longer ones in a
+        // single reference counted block followed by the characters.
+        struct string_type
+        {
+            static constexpr std::size_t capacity = 31;
+
+            ~string_type() noexcept
+            {
+                release();
+            }
+
+            string_type() noexcept
+            {
+                bytes_[capacity] = 0;
+            }
+
+            explicit string_type(std::string_view view) noexcept;
+
+            string_type(const string_type &other) noexcept;
+
+            string_type(string_type &&other) noexcept
+            {
+                std::memcpy(bytes_, other.bytes_, sizeof(bytes_));
+                other.bytes_[capacity] = 0;
+            }
+
+            auto operator=(const string_type &other) noexcept -> string_type &
+            {
+                if (this != &other)
+                {
+                    string_type copy{other};
+                    *this = std::move(copy);
+                }
+                return *this;
+            }
+
+            auto operator=(string_type &&other) noexcept -> string_type &
+            {
+                if (this != &other)
+                {
+                    release();
+                    std::memcpy(bytes_, other.bytes_, sizeof(bytes_));
+                    other.bytes_[capacity] = 0;
+                }
+                return *this;
+            }
+
+            auto operator==(const string_type &other) const noexcept -> bool
+            {
+                if (!is_inline() && !other.is_inline() && heap() == other.heap())
+                {
+                    return true;
+                }
+                return view() == other.view();
+            }
+
+            auto operator!=(const string_type &other) const noexcept -> bool
+            {
+                return !(*this == other);
+            }
+
+            auto is_inline() const noexcept -> bool
+            {
+                return static_cast<unsigned char>(bytes_[capacity]) != heap_tag;
+            }
+
+            // Long strings compute their hash once and keep it in the block.
+            auto hash() const noexcept -> std::size_t;
+
+            auto view() const noexcept -> std::string_view
+            {
+                if (is_inline())
+                {
+                    return {bytes_, static_cast<unsigned char>(bytes_[capacity])};
+                }
+                const auto *block = heap();
+                return {reinterpret_cast<const char *>(block + 1), block->size};
+            }
+
+        private:
+            struct heap_type
+            {
+                std::atomic<std::size_t> count;
+                std::size_t size;
+                std::atomic<std::size_t> hash;
+            };
+
+            static constexpr unsigned char heap_tag = 0xFF;
+
+            auto heap() const noexcept -> heap_type *
+            {
+                heap_type *block;
+                std::memcpy(&block, bytes_, sizeof(block));
+                return block;
+            }
+
+            auto release() noexcept -> void;
+
+            alignas(std::uintptr_t) char bytes_[capacity + 1];
+        };
+
         using list_type = List::impl_type::persistent_type;
         using map_type = Map::impl_type::persistent_type;
+        using float_array_type = FloatArray::impl_type::persistent_type;
+        using int_array_type = IntArray::impl_type::persistent_type;
 
         using variant_type = std::variant<
             Null,
@@ -22,7 +130,10 @@ namespace traeger
             Float,
             string_type,
             list_type,
-            map_type>;
+            map_type,
+            Blob,
+            float_array_type,
+            int_array_type>;
 
         ~impl_type() noexcept = default;
 
@@ -42,6 +153,39 @@ namespace traeger
 
         auto get_string() const noexcept -> const string_type *;
 
+        auto identity_equals(const impl_type &other) const noexcept -> bool;
+
+        using path_iterator = List::impl_type::transient_type::iterator;
+
+        static auto find_in(const Value &value,
+                            path_iterator first,
+                            path_iterator last) noexcept -> const Value *;
+
+        static auto find_in(const Map::impl_type::transient_type &map,
+                            path_iterator first,
+                            path_iterator last) noexcept -> const Value *;
+
+        static auto find_in(const List::impl_type::transient_type &list,
+                            path_iterator first,
+                            path_iterator last) noexcept -> const Value *;
+
+        static auto update_in(Value &value,
+                              path_iterator first,
+                              path_iterator last,
+                              const Update &update) noexcept -> bool;
+
+        static auto update_in(Map::impl_type::transient_type &map,
+                              path_iterator first,
+                              path_iterator last,
+                              const Update &update) noexcept -> bool;
+
+        static auto update_in(List::impl_type::transient_type &list,
+                              path_iterator first,
+                              path_iterator last,
+                              const Update &update) noexcept -> bool;
+
+        static_assert(sizeof(string_layout_type) == sizeof(string_type));
+
         static_assert(sizeof(layout_type) == sizeof(variant_type));
 
         variant_type variant;
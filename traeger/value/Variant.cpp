@@ -40,10 +40,16 @@ namespace traeger
             overload{
                 [](auto variant)
                 { return Variant{variant}; },
+                [](const Value::impl_type::string_type &string)
+                { return Variant{String{string.view()}}; },
                 [](const Value::impl_type::list_type &values)
                 { return Variant{List{List::impl_type{values}}}; },
                 [](const Value::impl_type::map_type &values)
-                { return Variant{Map{Map::impl_type{values}}}; }},
+                { return Variant{Map{Map::impl_type{values}}}; },
+                [](const Value::impl_type::float_array_type &array)
+                { return Variant{FloatArray{FloatArray::impl_type{array}}}; },
+                [](const Value::impl_type::int_array_type &array)
+                { return Variant{IntArray{IntArray::impl_type{array}}}; }},
             value.impl().variant);
     }
 
@@ -53,10 +59,16 @@ namespace traeger
             overload{
                 [](auto variant)
                 { return Variant{variant}; },
+                [](Value::impl_type::string_type &&string)
+                { return Variant{String{string.view()}}; },
                 [](Value::impl_type::list_type &&values)
                 { return Variant{List{List::impl_type{std::move(values)}}}; },
                 [](Value::impl_type::map_type &&values)
-                { return Variant{Map{Map::impl_type{std::move(values)}}}; }},
+                { return Variant{Map{Map::impl_type{std::move(values)}}}; },
+                [](Value::impl_type::float_array_type &&array)
+                { return Variant{FloatArray{FloatArray::impl_type{std::move(array)}}}; },
+                [](Value::impl_type::int_array_type &&array)
+                { return Variant{IntArray{IntArray::impl_type{std::move(array)}}}; }},
             std::move(value.impl().variant));
     }
 }
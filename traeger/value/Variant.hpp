@@ -16,7 +16,10 @@ namespace traeger
         Float,
         String,
         List,
-        Map>;
+        Map,
+        Blob,
+        FloatArray,
+        IntArray>;
 
     auto value_from_variant(const Variant &variant) noexcept -> Value;
 
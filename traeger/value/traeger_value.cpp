@@ -1,9 +1,13 @@
 // SPDX-License-Identifier: BSL-1.0
 
 #include <iostream>
+#include <optional>
 #include <sstream>
+#include <string_view>
+#include <vector>
 
 #include "traeger/value/traeger_value.hpp"
+#include "traeger/value/Diff.hpp"
 
 namespace
 {
@@ -14,6 +18,13 @@ namespace
         ss << self;
         return new traeger_string_t{std::move(ss).str()};
     }
+
+    // Keys that are only looked up are not interned nor copied into a String.
+    auto find_key(const char *key_data,
+                  const size_t key_size) noexcept -> std::optional<traeger::Atom>
+    {
+        return traeger::Atom::find(std::string_view{key_data, key_size});
+    }
 }
 
 extern "C"
@@ -215,6 +226,78 @@ extern "C"
         }
     }
 
+    void traeger_list_append_blob(traeger_list_t *self,
+                                  const char *blob_data,
+                                  const size_t blob_size)
+    {
+        if (self != nullptr &&
+            blob_data != nullptr)
+        {
+            cast(self).append(Blob{blob_data, blob_size});
+        }
+    }
+
+    void traeger_list_append_values(traeger_list_t *self,
+                                    const traeger_value_t *const *values,
+                                    const size_t size)
+    {
+        if (self != nullptr &&
+            values != nullptr)
+        {
+            std::vector<Value> elements;
+            elements.reserve(size);
+            for (size_t n = 0; n < size; ++n)
+            {
+                elements.emplace_back(values[n] != nullptr ? cast(values[n]) : Value{});
+            }
+            cast(self).append_range(std::move(elements));
+        }
+    }
+
+    void traeger_list_append_bools(traeger_list_t *self,
+                                   const traeger_bool_t *values,
+                                   const size_t size)
+    {
+        if (self != nullptr &&
+            values != nullptr)
+        {
+            cast(self).append_range(values, values + size);
+        }
+    }
+
+    void traeger_list_append_ints(traeger_list_t *self,
+                                  const traeger_int_t *values,
+                                  const size_t size)
+    {
+        if (self != nullptr &&
+            values != nullptr)
+        {
+            cast(self).append_range(values, values + size);
+        }
+    }
+
+    void traeger_list_append_uints(traeger_list_t *self,
+                                   const traeger_uint_t *values,
+                                   const size_t size)
+    {
+        if (self != nullptr &&
+            values != nullptr)
+        {
+            cast(self).append_range(values, values + size);
+        }
+    }
+
+    void traeger_list_append_floats(traeger_list_t *self,
+                                    const traeger_float_t *values,
+                                    const size_t size)
+    {
+        if (self != nullptr &&
+            values != nullptr)
+        {
+            cast(self).append_range(values, values + size);
+        }
+    }
+
     void traeger_list_set_value(traeger_list_t *self,
                                 const int index,
                                 const traeger_value_t *value)
@@ -312,6 +395,18 @@ extern "C"
         }
     }
 
+    void traeger_list_set_blob(traeger_list_t *self,
+                               const int index,
+                               const char *blob_data,
+                               const size_t blob_size)
+    {
+        if (self != nullptr &&
+            blob_data != nullptr)
+        {
+            cast(self).set(index, Blob{blob_data, blob_size});
+        }
+    }
+
     bool traeger_list_find(const traeger_list_t *self,
                            const int index,
                            traeger_value_t **value)
@@ -328,6 +423,16 @@ extern "C"
         return false;
     }
 
+    const traeger_value_t *traeger_list_find_borrowed(const traeger_list_t *self,
+                                                      const int index)
+    {
+        if (self != nullptr)
+        {
+            return borrow(cast(self).find(index));
+        }
+        return nullptr;
+    }
+
     bool traeger_list_empty(const traeger_list_t *self)
     {
         if (self != nullptr)
@@ -356,6 +461,100 @@ extern "C"
         return 0;
     }
 
+    traeger_list_t *traeger_list_slice(const traeger_list_t *self,
+                                       const int first,
+                                       const int last)
+    {
+        if (self != nullptr)
+        {
+            return new traeger_list_t{cast(self).slice(first, last)};
+        }
+        return nullptr;
+    }
+
+    traeger_list_t *traeger_list_concat(const traeger_list_t *self,
+                                        const traeger_list_t *other)
+    {
+        if (self != nullptr &&
+            other != nullptr)
+        {
+            return new traeger_list_t{cast(self).concat(cast(other))};
+        }
+        return nullptr;
+    }
+
+    bool traeger_list_insert_value(traeger_list_t *self,
+                                   const int index,
+                                   const traeger_value_t *value)
+    {
+        if (self != nullptr &&
+            value != nullptr)
+        {
+            return cast(self).insert(index, cast(value));
+        }
+        return false;
+    }
+
+    bool traeger_list_erase(traeger_list_t *self,
+                            const int index)
+    {
+        if (self != nullptr)
+        {
+            return cast(self).erase(index);
+        }
+        return false;
+    }
+
+    bool traeger_list_get_in(const traeger_list_t *self,
+                             const traeger_list_t *path,
+                             traeger_value_t **value)
+    {
+        if (self != nullptr &&
+            path != nullptr &&
+            value != nullptr)
+        {
+            if (const auto *ptr_value = cast(self).get_in(cast(path)); ptr_value)
+            {
+                *value = new traeger_value_t{*ptr_value};
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool traeger_list_set_in(traeger_list_t *self,
+                             const traeger_list_t *path,
+                             const traeger_value_t *value)
+    {
+        if (self != nullptr &&
+            path != nullptr &&
+            value != nullptr)
+        {
+            return cast(self).set_in(cast(path), cast(value));
+        }
+        return false;
+    }
+
+    bool traeger_list_update_in(traeger_list_t *self,
+                                const traeger_list_t *path,
+                                traeger_value_update_t update,
+                                void *closure)
+    {
+        if (self != nullptr &&
+            path != nullptr &&
+            update != nullptr)
+        {
+            return cast(self).update_in(cast(path),
+                                        [update, closure](const Value &value) -> Value
+                                        {
+                                            traeger_value_t result{value};
+                                            update(closure, &result);
+                                            return std::move(result);
+                                        });
+        }
+        return false;
+    }
+
     // List::Iterator
 
     traeger_list_iterator_t *traeger_list_iterator_new(const traeger_list_t *self)
@@ -367,6 +566,18 @@ extern "C"
         return nullptr;
     }
 
+    traeger_list_iterator_t *traeger_list_iterator_new_borrowed(const traeger_value_t *value)
+    {
+        if (value != nullptr)
+        {
+            if (const auto view = cast(value).get_list_view(); view)
+            {
+                return new traeger_list_iterator_t{view->begin()};
+            }
+        }
+        return nullptr;
+    }
+
     void traeger_list_iterator_free(traeger_list_iterator_t *self)
     {
 
@@ -403,6 +614,24 @@ extern "C"
         return false;
     }
 
+    bool traeger_list_iterator_next_borrowed(traeger_list_iterator_t *self,
+                                             const traeger_value_t **value)
+    {
+        if (self != nullptr)
+        {
+            if (cast(self))
+            {
+                if (value != nullptr)
+                {
+                    *value = borrow(&cast(self).value());
+                }
+                cast(self).increment();
+                return true;
+            }
+        }
+        return false;
+    }
+
     // Map
 
     traeger_map_t *traeger_map_new()
@@ -569,6 +798,20 @@ extern "C"
         }
     }
 
+    void traeger_map_set_blob(traeger_map_t *self,
+                              const char *key_data,
+                              const size_t key_size,
+                              const char *blob_data,
+                              const size_t blob_size)
+    {
+        if (self != nullptr &&
+            key_data != nullptr &&
+            blob_data != nullptr)
+        {
+            cast(self).set(String(key_data, key_size), Blob{blob_data, blob_size});
+        }
+    }
+
     void traeger_map_erase(traeger_map_t *self,
                            const char *key_data,
                            const size_t key_size)
@@ -576,7 +819,10 @@ extern "C"
         if (self != nullptr &&
             key_data != nullptr)
         {
-            cast(self).erase(String(key_data, key_size));
+            if (const auto key = find_key(key_data, key_size); key)
+            {
+                cast(self).erase(key.value());
+            }
         }
     }
 
@@ -587,7 +833,8 @@ extern "C"
         if (self != nullptr &&
             key_data != nullptr)
         {
-            return cast(self).contains(String(key_data, key_size));
+            const auto key = find_key(key_data, key_size);
+            return key && cast(self).contains(key.value());
         }
         return false;
     }
@@ -600,15 +847,33 @@ extern "C"
         if (self != nullptr &&
             key_data != nullptr)
         {
-            if (const auto *ptr_value = cast(self).find(String(key_data, key_size)); ptr_value)
+            if (const auto key = find_key(key_data, key_size); key)
             {
-                *value = new traeger_value_t{*ptr_value};
-                return true;
+                if (const auto *ptr_value = cast(self).find(key.value()); ptr_value)
+                {
+                    *value = new traeger_value_t{*ptr_value};
+                    return true;
+                }
             }
         }
         return false;
     }
 
+    const traeger_value_t *traeger_map_find_borrowed(const traeger_map_t *self,
+                                                     const char *key_data,
+                                                     const size_t key_size)
+    {
+        if (self != nullptr &&
+            key_data != nullptr)
+        {
+            if (const auto key = find_key(key_data, key_size); key)
+            {
+                return borrow(cast(self).find(key.value()));
+            }
+        }
+        return nullptr;
+    }
+
     bool traeger_map_empty(const traeger_map_t *self)
     {
         if (self != nullptr)
@@ -627,6 +892,56 @@ extern "C"
         return 0;
     }
 
+    bool traeger_map_get_in(const traeger_map_t *self,
+                            const traeger_list_t *path,
+                            traeger_value_t **value)
+    {
+        if (self != nullptr &&
+            path != nullptr &&
+            value != nullptr)
+        {
+            if (const auto *ptr_value = cast(self).get_in(cast(path)); ptr_value)
+            {
+                *value = new traeger_value_t{*ptr_value};
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool traeger_map_set_in(traeger_map_t *self,
+                            const traeger_list_t *path,
+                            const traeger_value_t *value)
+    {
+        if (self != nullptr &&
+            path != nullptr &&
+            value != nullptr)
+        {
+            return cast(self).set_in(cast(path), cast(value));
+        }
+        return false;
+    }
+
+    bool traeger_map_update_in(traeger_map_t *self,
+                               const traeger_list_t *path,
+                               traeger_value_update_t update,
+                               void *closure)
+    {
+        if (self != nullptr &&
+            path != nullptr &&
+            update != nullptr)
+        {
+            return cast(self).update_in(cast(path),
+                                        [update, closure](const Value &value) -> Value
+                                        {
+                                            traeger_value_t result{value};
+                                            update(closure, &result);
+                                            return std::move(result);
+                                        });
+        }
+        return false;
+    }
+
     // Map::Iterator
 
     traeger_map_iterator_t *traeger_map_iterator_new(const traeger_map_t *self)
@@ -638,6 +953,18 @@ extern "C"
         return nullptr;
     }
 
+    traeger_map_iterator_t *traeger_map_iterator_new_borrowed(const traeger_value_t *value)
+    {
+        if (value != nullptr)
+        {
+            if (const auto view = cast(value).get_map_view(); view)
+            {
+                return new traeger_map_iterator_t{view->begin()};
+            }
+        }
+        return nullptr;
+    }
+
     void traeger_map_iterator_free(traeger_map_iterator_t *self)
     {
 
@@ -679,6 +1006,33 @@ extern "C"
         return false;
     }
 
+    bool traeger_map_iterator_next_borrowed(traeger_map_iterator_t *self,
+                                            const char **key_data,
+                                            size_t *key_size,
+                                            const traeger_value_t **value)
+    {
+        if (self != nullptr)
+        {
+            if (cast(self))
+            {
+                if (value != nullptr)
+                {
+                    *value = borrow(&cast(self).value());
+                }
+                if (key_data != nullptr &&
+                    key_size != nullptr)
+                {
+                    const auto &key = cast(self).key();
+                    *key_data = key.data();
+                    *key_size = key.size();
+                }
+                cast(self).increment();
+                return true;
+            }
+        }
+        return false;
+    }
+
     traeger_value_t *traeger_value_new()
     {
         return new traeger_value_t{};
@@ -728,6 +1082,50 @@ extern "C"
         return false;
     }
 
+    size_t traeger_value_hash(const traeger_value_t *self)
+    {
+        if (self != nullptr)
+        {
+            return cast(self).hash();
+        }
+        return 0;
+    }
+
+    void traeger_value_diff(const traeger_value_t *old_value,
+                            const traeger_value_t *new_value,
+                            traeger_value_t **delta)
+    {
+        if (old_value != nullptr &&
+            new_value != nullptr &&
+            delta != nullptr)
+        {
+            *delta = new traeger_value_t{traeger::diff(cast(old_value), cast(new_value))};
+        }
+    }
+
+    bool traeger_value_patch(const traeger_value_t *base,
+                             const traeger_value_t *delta,
+                             traeger_value_t **result,
+                             traeger_string_t **error)
+    {
+        if (base != nullptr &&
+            delta != nullptr &&
+            result != nullptr)
+        {
+            if (auto [patch_result, patch_error] = traeger::patch(cast(base), cast(delta));
+                patch_result)
+            {
+                *result = new traeger_value_t{std::move(patch_result).value()};
+                return true;
+            }
+            else if (error)
+            {
+                *error = new traeger_string_t{std::move(patch_error)};
+            }
+        }
+        return false;
+    }
+
     traeger_value_type_t traeger_value_get_type(const traeger_value_t *self)
     {
         if (self != nullptr)
@@ -826,6 +1224,58 @@ extern "C"
         }
     }
 
+    void traeger_value_set_blob(traeger_value_t *self,
+                                const char *blob_data,
+                                const size_t blob_size)
+    {
+        if (self != nullptr &&
+            blob_data != nullptr)
+        {
+            cast(self) = Blob{blob_data, blob_size};
+        }
+    }
+
+    void traeger_value_set_blob_external(traeger_value_t *self,
+                                         const char *blob_data,
+                                         const size_t blob_size,
+                                         traeger_blob_release_t release,
+                                         void *closure)
+    {
+        if (self != nullptr &&
+            blob_data != nullptr)
+        {
+            Blob::Release blob_release;
+            if (release != nullptr)
+            {
+                blob_release = [release, closure]
+                { release(closure); };
+            }
+            cast(self) = Blob{blob_data, blob_size, std::move(blob_release)};
+        }
+    }
+
+    void traeger_value_set_float_array(traeger_value_t *self,
+                                       const traeger_float_t *array_data,
+                                       const size_t array_size)
+    {
+        if (self != nullptr &&
+            (array_data != nullptr || array_size == 0))
+        {
+            cast(self) = FloatArray{array_data, array_size};
+        }
+    }
+
+    void traeger_value_set_int_array(traeger_value_t *self,
+                                     const traeger_int_t *array_data,
+                                     const size_t array_size)
+    {
+        if (self != nullptr &&
+            (array_data != nullptr || array_size == 0))
+        {
+            cast(self) = IntArray{array_data, array_size};
+        }
+    }
+
     void traeger_value_set_value(traeger_value_t *self,
                                  const traeger_value_t *value)
     {
@@ -919,10 +1369,10 @@ extern "C"
         if (self != nullptr &&
             string != nullptr)
         {
-            if (const auto ptr = cast(self).get_string();
-                ptr)
+            if (const auto optional = cast(self).get_string();
+                optional)
             {
-                *string = new traeger_string_t{*ptr};
+                *string = new traeger_string_t{String{optional.value()}};
                 return true;
             }
         }
@@ -960,4 +1410,110 @@ extern "C"
         }
         return false;
     }
+
+    bool traeger_value_get_size(const traeger_value_t *self,
+                                size_t *size)
+    {
+        if (self != nullptr &&
+            size != nullptr)
+        {
+            if (const auto view = cast(self).get_list_view(); view)
+            {
+                *size = view->size();
+                return true;
+            }
+            if (const auto view = cast(self).get_map_view(); view)
+            {
+                *size = view->size();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    const traeger_value_t *traeger_value_list_find(const traeger_value_t *self,
+                                                   const int index)
+    {
+        if (self != nullptr)
+        {
+            if (const auto view = cast(self).get_list_view(); view)
+            {
+                return borrow(view->find(index));
+            }
+        }
+        return nullptr;
+    }
+
+    const traeger_value_t *traeger_value_map_find(const traeger_value_t *self,
+                                                  const char *key_data,
+                                                  const size_t key_size)
+    {
+        if (self != nullptr &&
+            key_data != nullptr)
+        {
+            const auto key = find_key(key_data, key_size);
+            if (const auto view = cast(self).get_map_view(); view && key)
+            {
+                return borrow(view->find(key.value()));
+            }
+        }
+        return nullptr;
+    }
+
+    bool traeger_value_get_blob(const traeger_value_t *self,
+                                const char **blob_data,
+                                size_t *blob_size)
+    {
+        if (self != nullptr &&
+            blob_data != nullptr &&
+            blob_size != nullptr)
+        {
+            if (const auto optional = cast(self).get_blob();
+                optional)
+            {
+                *blob_data = optional->data();
+                *blob_size = optional->size();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool traeger_value_get_float_array(const traeger_value_t *self,
+                                       const traeger_float_t **array_data,
+                                       size_t *array_size)
+    {
+        if (self != nullptr &&
+            array_data != nullptr &&
+            array_size != nullptr)
+        {
+            if (const auto optional = cast(self).get_float_array();
+                optional)
+            {
+                *array_data = optional->data();
+                *array_size = optional->size();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool traeger_value_get_int_array(const traeger_value_t *self,
+                                     const traeger_int_t **array_data,
+                                     size_t *array_size)
+    {
+        if (self != nullptr &&
+            array_data != nullptr &&
+            array_size != nullptr)
+        {
+            if (const auto optional = cast(self).get_int_array();
+                optional)
+            {
+                *array_data = optional->data();
+                *array_size = optional->size();
+                return true;
+            }
+        }
+        return false;
+    }
 }
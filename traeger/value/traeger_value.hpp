@@ -2,6 +2,8 @@
 
 #pragma once
 
+#include <type_traits>
+
 #include "traeger/value/value.h"
 #include "traeger/value/Value.hpp"
 
@@ -48,6 +50,18 @@ namespace traeger
         return *static_cast<const Value *>(value);
     }
 
+    // traeger_value_t adds nothing to Value, so values are lent to C as is.
+    // A Value is not a traeger_value_t, so the pointer is reinterpreted
+    // rather than cast down, which relies on both sharing the layout.
+    static_assert(sizeof(traeger_value_t) == sizeof(Value));
+    static_assert(alignof(traeger_value_t) == alignof(Value));
+    static_assert(std::is_standard_layout_v<Value> && std::is_standard_layout_v<traeger_value_t>);
+
+    inline auto borrow(const Value *value) noexcept -> const traeger_value_t *
+    {
+        return reinterpret_cast<const traeger_value_t *>(value);
+    }
+
     inline auto cast(traeger_list_iterator_t *iterator) noexcept -> List::Iterator &
     {
         return *static_cast<List::Iterator *>(iterator);
@@ -15,6 +15,9 @@ typedef enum traeger_value_type_t
     TRAEGER_VALUE_TYPE_STRING = 5,
     TRAEGER_VALUE_TYPE_LIST = 6,
     TRAEGER_VALUE_TYPE_MAP = 7,
+    TRAEGER_VALUE_TYPE_BLOB = 8,
+    TRAEGER_VALUE_TYPE_FLOAT_ARRAY = 9,
+    TRAEGER_VALUE_TYPE_INT_ARRAY = 10,
 } traeger_value_type_t;
 
 typedef bool traeger_bool_t;
@@ -25,6 +25,11 @@ typedef struct traeger_value_t traeger_value_t;
 
 typedef const traeger_value_t traeger_const_value_t;
 
+typedef void (*traeger_blob_release_t)(void *closure);
+
+typedef void (*traeger_value_update_t)(void *closure,
+                                       traeger_value_t *value);
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -93,6 +98,30 @@ extern "C"
     void traeger_list_append_map(traeger_list_t *self,
                                  const traeger_map_t *map);
 
+    void traeger_list_append_blob(traeger_list_t *self,
+                                  const char *blob_data,
+                                  size_t blob_size);
+
+    void traeger_list_append_values(traeger_list_t *self,
+                                    const traeger_value_t *const *values,
+                                    size_t size);
+
+    void traeger_list_append_bools(traeger_list_t *self,
+                                   const traeger_bool_t *values,
+                                   size_t size);
+
+    void traeger_list_append_ints(traeger_list_t *self,
+                                  const traeger_int_t *values,
+                                  size_t size);
+
+    void traeger_list_append_uints(traeger_list_t *self,
+                                   const traeger_uint_t *values,
+                                   size_t size);
+
+    void traeger_list_append_floats(traeger_list_t *self,
+                                    const traeger_float_t *values,
+                                    size_t size);
+
     void traeger_list_set_value(traeger_list_t *self,
                                 int index,
                                 const traeger_value_t *value);
@@ -129,10 +158,19 @@ extern "C"
                               int index,
                               const traeger_map_t *map);
 
+    void traeger_list_set_blob(traeger_list_t *self,
+                               int index,
+                               const char *blob_data,
+                               size_t blob_size);
+
     bool traeger_list_find(const traeger_list_t *self,
                            int index,
                            traeger_value_t **value);
 
+    // The value is borrowed and valid as long as the list is not modified.
+    const traeger_value_t *traeger_list_find_borrowed(const traeger_list_t *self,
+                                                      int index);
+
     bool traeger_list_empty(const traeger_list_t *self);
 
     size_t traeger_list_size(const traeger_list_t *self);
@@ -140,15 +178,51 @@ extern "C"
     size_t traeger_list_resize(traeger_list_t *self,
                                size_t new_size);
 
+    traeger_list_t *traeger_list_slice(const traeger_list_t *self,
+                                       int first,
+                                       int last);
+
+    traeger_list_t *traeger_list_concat(const traeger_list_t *self,
+                                        const traeger_list_t *other);
+
+    bool traeger_list_insert_value(traeger_list_t *self,
+                                   int index,
+                                   const traeger_value_t *value);
+
+    bool traeger_list_erase(traeger_list_t *self,
+                            int index);
+
+    // The path is a list of map keys and list indices.
+    bool traeger_list_get_in(const traeger_list_t *self,
+                             const traeger_list_t *path,
+                             traeger_value_t **value);
+
+    bool traeger_list_set_in(traeger_list_t *self,
+                             const traeger_list_t *path,
+                             const traeger_value_t *value);
+
+    // The update receives a copy of the value at the path to modify in place.
+    bool traeger_list_update_in(traeger_list_t *self,
+                                const traeger_list_t *path,
+                                traeger_value_update_t update,
+                                void *closure);
+
     // List::Iterator
 
     traeger_list_iterator_t *traeger_list_iterator_new(const traeger_list_t *self);
 
+    // The iterator borrows the list held by the value.
+    traeger_list_iterator_t *traeger_list_iterator_new_borrowed(const traeger_value_t *value);
+
     bool traeger_list_iterator_has_next(const traeger_list_iterator_t *self);
 
     bool traeger_list_iterator_next(traeger_list_iterator_t *self,
                                     traeger_value_t **value);
 
+    // The value is borrowed and valid as long as the list is not modified.
+    bool traeger_list_iterator_next_borrowed(traeger_list_iterator_t *self,
+                                             const traeger_value_t **value);
+
     void traeger_list_iterator_free(traeger_list_iterator_t *self);
 
     // Map
@@ -212,6 +286,12 @@ extern "C"
                              size_t key_size,
                              const traeger_map_t *map);
 
+    void traeger_map_set_blob(traeger_map_t *self,
+                              const char *key_data,
+                              size_t key_size,
+                              const char *blob_data,
+                              size_t blob_size);
+
     void traeger_map_erase(traeger_map_t *self,
                            const char *key_data,
                            size_t key_size);
@@ -225,20 +305,49 @@ extern "C"
                           size_t key_size,
                           traeger_value_t **value);
 
+    // The value is borrowed and valid as long as the map is not modified.
+    const traeger_value_t *traeger_map_find_borrowed(const traeger_map_t *self,
+                                                     const char *key_data,
+                                                     size_t key_size);
+
     bool traeger_map_empty(const traeger_map_t *self);
 
     size_t traeger_map_size(const traeger_map_t *self);
 
+    // The path is a list of map keys and list indices.
+    bool traeger_map_get_in(const traeger_map_t *self,
+                            const traeger_list_t *path,
+                            traeger_value_t **value);
+
+    bool traeger_map_set_in(traeger_map_t *self,
+                            const traeger_list_t *path,
+                            const traeger_value_t *value);
+
+    // The update receives a copy of the value at the path to modify in place.
+    bool traeger_map_update_in(traeger_map_t *self,
+                               const traeger_list_t *path,
+                               traeger_value_update_t update,
+                               void *closure);
+
     // Map::Iterator
 
     traeger_map_iterator_t *traeger_map_iterator_new(const traeger_map_t *self);
 
+    // The iterator borrows the map held by the value.
+    traeger_map_iterator_t *traeger_map_iterator_new_borrowed(const traeger_value_t *value);
+
     bool traeger_map_iterator_has_next(const traeger_map_iterator_t *self);
 
     bool traeger_map_iterator_next(traeger_map_iterator_t *self,
                                    traeger_string_t **key,
                                    traeger_value_t **value);
 
+    // The key and the value are borrowed and valid as long as the map is not modified.
+    bool traeger_map_iterator_next_borrowed(traeger_map_iterator_t *self,
+                                            const char **key_data,
+                                            size_t *key_size,
+                                            const traeger_value_t **value);
+
     void traeger_map_iterator_free(traeger_map_iterator_t *self);
 
     // Value
@@ -257,6 +366,17 @@ extern "C"
     bool traeger_value_equal(const traeger_value_t *self,
                              const traeger_value_t *other);
 
+    size_t traeger_value_hash(const traeger_value_t *self);
+
+    void traeger_value_diff(const traeger_value_t *old_value,
+                            const traeger_value_t *new_value,
+                            traeger_value_t **delta);
+
+    bool traeger_value_patch(const traeger_value_t *base,
+                             const traeger_value_t *delta,
+                             traeger_value_t **result,
+                             traeger_string_t **error);
+
     traeger_value_type_t traeger_value_get_type(const traeger_value_t *self);
 
     const char *traeger_value_get_type_name(const traeger_value_t *self);
@@ -287,6 +407,26 @@ extern "C"
     void traeger_value_set_map(traeger_value_t *self,
                                const traeger_map_t *map);
 
+    void traeger_value_set_blob(traeger_value_t *self,
+                                const char *blob_data,
+                                size_t blob_size);
+
+    // The blob borrows the memory, release is called with the closure
+    // once the last copy of the blob is destroyed.
+    void traeger_value_set_blob_external(traeger_value_t *self,
+                                         const char *blob_data,
+                                         size_t blob_size,
+                                         traeger_blob_release_t release,
+                                         void *closure);
+
+    void traeger_value_set_float_array(traeger_value_t *self,
+                                       const traeger_float_t *array_data,
+                                       size_t array_size);
+
+    void traeger_value_set_int_array(traeger_value_t *self,
+                                     const traeger_int_t *array_data,
+                                     size_t array_size);
+
     void traeger_value_set_value(traeger_value_t *self,
                                  const traeger_value_t *value);
 
@@ -313,6 +453,33 @@ extern "C"
     bool traeger_value_get_map(const traeger_value_t *self,
                                traeger_map_t **map);
 
+    bool traeger_value_get_size(const traeger_value_t *self,
+                                size_t *size);
+
+    // The element is borrowed and valid as long as the value is not modified.
+    const traeger_value_t *traeger_value_list_find(const traeger_value_t *self,
+                                                   int index);
+
+    // The element is borrowed and valid as long as the value is not modified.
+    const traeger_value_t *traeger_value_map_find(const traeger_value_t *self,
+                                                  const char *key_data,
+                                                  size_t key_size);
+
+    // The bytes are borrowed and valid as long as the value is not modified.
+    bool traeger_value_get_blob(const traeger_value_t *self,
+                                const char **blob_data,
+                                size_t *blob_size);
+
+    // The elements are borrowed and valid as long as the value is not modified.
+    bool traeger_value_get_float_array(const traeger_value_t *self,
+                                       const traeger_float_t **array_data,
+                                       size_t *array_size);
+
+    // The elements are borrowed and valid as long as the value is not modified.
+    bool traeger_value_get_int_array(const traeger_value_t *self,
+                                     const traeger_int_t **array_data,
+                                     size_t *array_size);
+
 #ifdef __cplusplus
 }
 #endif